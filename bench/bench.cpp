@@ -0,0 +1,217 @@
+// Headless DSP benchmark for the shapetaker modules.
+//
+// Builds every module against a bare Rack context (engine present but never
+// started, no window), feeds its inputs with deterministic signals and times
+// Module::process() directly. Results are printed as a table and written as
+// JSON so numbers can be compared between commits.
+//
+// With --golden-record / --golden-compare the same stimulus is rendered into
+// reference WAVs instead (see golden.cpp). --fastmath-check runs the accuracy
+// check of the fast transcendentals (see fastmath.cpp).
+//
+// Usage: shapetaker_bench [--seconds S] [--module NAME] [--channels N]
+//                         [--rate HZ] [--json PATH]
+//        shapetaker_bench --golden-record|--golden-compare [--golden-dir DIR]
+//                         [--module NAME]
+//        shapetaker_bench --fastmath-check
+
+#include "harness.hpp"
+
+#include <algorithm>
+#include <chrono>
+#include <cmath>
+#include <cstdio>
+#include <cstdlib>
+#include <iterator>
+#include <string>
+#include <vector>
+
+using namespace shapetaker::bench;
+
+namespace {
+
+const float kSampleRates[] = {44100.f, 48000.f, 96000.f};
+
+struct BenchOptions {
+    float seconds = 1.f;
+    float warmupSeconds = 0.1f;
+    std::string moduleFilter;
+    int channels = 0;     // 0 = sweep 1..kMaxChannels
+    float sampleRate = 0.f; // 0 = sweep kSampleRates
+    std::string jsonPath = "build/bench/bench.json";
+    bool golden = false;
+    GoldenOptions goldenOptions;
+    bool fastMathCheck = false;
+};
+
+struct BenchResult {
+    std::string module;
+    int channels = 1;
+    float sampleRate = 44100.f;
+    double nsPerSample = 0.0;
+    double realtimePercent = 0.0;
+};
+
+// ============================================================================
+// RUNNER
+// ============================================================================
+
+BenchResult runModule(const BenchModule& entry, int channels, float sampleRate, const BenchOptions& options) {
+    ModuleDriver driver(entry, channels, sampleRate);
+
+    const int64_t warmupFrames = (int64_t)(options.warmupSeconds * sampleRate);
+    const int64_t timedFrames = std::max<int64_t>(1, (int64_t)(options.seconds * sampleRate));
+
+    while (driver.getFrame() < warmupFrames) {
+        driver.prepareBlock((int)std::min<int64_t>(kBlockFrames, warmupFrames - driver.getFrame()));
+        driver.processBlock();
+    }
+
+    std::chrono::steady_clock::duration elapsed(0);
+    const int64_t endFrame = driver.getFrame() + timedFrames;
+    while (driver.getFrame() < endFrame) {
+        driver.prepareBlock((int)std::min<int64_t>(kBlockFrames, endFrame - driver.getFrame()));
+        auto start = std::chrono::steady_clock::now();
+        driver.processBlock();
+        elapsed += std::chrono::steady_clock::now() - start;
+    }
+
+    BenchResult result;
+    result.module = entry.name;
+    result.channels = channels;
+    result.sampleRate = sampleRate;
+    double elapsedNs = (double)std::chrono::duration_cast<std::chrono::nanoseconds>(elapsed).count();
+    result.nsPerSample = elapsedNs / (double)timedFrames;
+    // Share of one core needed to keep up in real time
+    result.realtimePercent = result.nsPerSample * sampleRate * 1e-7;
+    return result;
+}
+
+bool writeJson(const std::vector<BenchResult>& results, const BenchOptions& options) {
+    json_t* rootJ = json_object();
+    json_object_set_new(rootJ, "seconds", json_real(options.seconds));
+    json_t* resultsJ = json_array();
+    for (const BenchResult& result : results) {
+        json_t* entryJ = json_object();
+        json_object_set_new(entryJ, "module", json_string(result.module.c_str()));
+        json_object_set_new(entryJ, "channels", json_integer(result.channels));
+        json_object_set_new(entryJ, "sampleRate", json_real(result.sampleRate));
+        json_object_set_new(entryJ, "nsPerSample", json_real(result.nsPerSample));
+        json_object_set_new(entryJ, "realtimePercent", json_real(result.realtimePercent));
+        json_array_append_new(resultsJ, entryJ);
+    }
+    json_object_set_new(rootJ, "results", resultsJ);
+
+    system::createDirectories(system::getDirectory(options.jsonPath));
+    int err = json_dump_file(rootJ, options.jsonPath.c_str(), JSON_INDENT(2) | JSON_REAL_PRECISION(6));
+    json_decref(rootJ);
+    return err == 0;
+}
+
+bool parseOptions(int argc, char** argv, BenchOptions& options) {
+    for (int i = 1; i < argc; ++i) {
+        std::string arg = argv[i];
+        bool hasValue = i + 1 < argc;
+        if (arg == "--seconds" && hasValue) {
+            options.seconds = std::max(0.01f, (float)std::atof(argv[++i]));
+        } else if (arg == "--module" && hasValue) {
+            options.moduleFilter = argv[++i];
+        } else if (arg == "--channels" && hasValue) {
+            options.channels = rack::math::clamp(std::atoi(argv[++i]), 1, kMaxChannels);
+        } else if (arg == "--rate" && hasValue) {
+            options.sampleRate = std::max(1000.f, (float)std::atof(argv[++i]));
+        } else if (arg == "--json" && hasValue) {
+            options.jsonPath = argv[++i];
+        } else if (arg == "--golden-record" || arg == "--golden-compare") {
+            options.golden = true;
+            options.goldenOptions.record = arg == "--golden-record";
+        } else if (arg == "--golden-dir" && hasValue) {
+            options.goldenOptions.directory = argv[++i];
+        } else if (arg == "--fastmath-check") {
+            options.fastMathCheck = true;
+        } else {
+            std::fprintf(stderr,
+                "usage: %s [--seconds S] [--module NAME] [--channels N] [--rate HZ] [--json PATH]\n"
+                "       %s --golden-record|--golden-compare [--golden-dir DIR] [--module NAME]\n"
+                "       %s --fastmath-check\n",
+                argv[0], argv[0], argv[0]);
+            return false;
+        }
+    }
+    return true;
+}
+
+} // namespace
+
+int main(int argc, char** argv) {
+    BenchOptions options;
+    if (!parseOptions(argc, argv, options)) {
+        return 1;
+    }
+
+    // Pure math, no Rack context needed
+    if (options.fastMathCheck) {
+        return runFastMathCheck();
+    }
+
+    // Minimal headless Rack: assets resolve relative to the repo root
+    settings::devMode = true;
+    settings::headless = true;
+    asset::init();
+    logger::init();
+
+    contextSet(new Context);
+    APP->engine = new engine::Engine;
+
+    Plugin* plugin = new Plugin;
+    plugin->path = ".";
+    init(plugin);
+
+    if (options.golden) {
+        options.goldenOptions.moduleFilter = options.moduleFilter;
+        int status = runGolden(options.goldenOptions);
+        logger::destroy();
+        return status;
+    }
+
+    std::vector<int> channelCounts;
+    for (int c = 1; c <= kMaxChannels; ++c) {
+        if (options.channels == 0 || options.channels == c) {
+            channelCounts.push_back(c);
+        }
+    }
+    std::vector<float> sampleRates;
+    if (options.sampleRate > 0.f) {
+        sampleRates.push_back(options.sampleRate);
+    } else {
+        sampleRates.assign(std::begin(kSampleRates), std::end(kSampleRates));
+    }
+
+    std::vector<BenchResult> results;
+    std::printf("%-14s %4s %8s %12s %10s\n", "module", "ch", "rate", "ns/sample", "%rt");
+    for (const BenchModule& entry : kBenchModules) {
+        if (!options.moduleFilter.empty() && options.moduleFilter != entry.name) {
+            continue;
+        }
+        for (float sampleRate : sampleRates) {
+            for (int channels : channelCounts) {
+                BenchResult result = runModule(entry, channels, sampleRate, options);
+                std::printf("%-14s %4d %8.0f %12.1f %9.2f%%\n", result.module.c_str(), result.channels,
+                            result.sampleRate, result.nsPerSample, result.realtimePercent);
+                std::fflush(stdout);
+                results.push_back(result);
+            }
+        }
+    }
+
+    bool ok = writeJson(results, options);
+    if (ok) {
+        std::printf("wrote %s\n", options.jsonPath.c_str());
+    } else {
+        std::fprintf(stderr, "failed to write %s\n", options.jsonPath.c_str());
+    }
+
+    // Models are owned by the plugin; leave teardown to process exit
+    logger::destroy();
+    return ok ? 0 : 1;
+}
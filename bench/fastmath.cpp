@@ -0,0 +1,128 @@
+// Accuracy check for src/dsp/fastmath.hpp.
+//
+// Sweeps every approximation (scalar and float_4) over its documented domain,
+// measures the worst error against double-precision libm and compares it to
+// the bound stated in the header. Exits non-zero if any bound is exceeded.
+
+#include "harness.hpp"
+#include "dsp/fastmath.hpp"
+
+#include <cmath>
+#include <cstdio>
+#include <functional>
+
+namespace shapetaker {
+namespace bench {
+
+namespace {
+
+namespace fm = shapetaker::dsp::fastmath;
+
+constexpr int kSweepPoints = 1 << 20;
+
+enum ErrorKind {
+    ERROR_ABSOLUTE,
+    ERROR_RELATIVE,
+    // Absolute below magnitude 1, relative above
+    ERROR_MIXED,
+};
+
+struct FastMathCase {
+    const char* name;
+    double lo;
+    double hi;
+    ErrorKind kind;
+    double bound;
+    std::function<double(double)> reference;
+    std::function<float(float)> scalar;
+    std::function<simd::float_4(simd::float_4)> vector;
+};
+
+double errorOf(ErrorKind kind, double reference, double value) {
+    double err = std::fabs(value - reference);
+    if (kind == ERROR_RELATIVE) {
+        err /= std::max(std::fabs(reference), 1e-30);
+    } else if (kind == ERROR_MIXED) {
+        err /= std::max(std::fabs(reference), 1.0);
+    }
+    return err;
+}
+
+const char* const kindNames[] = {"abs", "rel", "mix"};
+
+bool runCase(const FastMathCase& c) {
+    double worstScalar = 0.0;
+    double worstVector = 0.0;
+    for (int i = 0; i < kSweepPoints; i += 4) {
+        float x[4];
+        for (int lane = 0; lane < 4; ++lane) {
+            x[lane] = (float)(c.lo + (c.hi - c.lo) * (double)(i + lane) / (kSweepPoints - 1));
+        }
+        simd::float_4 v = c.vector(simd::float_4::load(x));
+        for (int lane = 0; lane < 4; ++lane) {
+            double reference = c.reference((double)x[lane]);
+            worstScalar = std::max(worstScalar, errorOf(c.kind, reference, c.scalar(x[lane])));
+            worstVector = std::max(worstVector, errorOf(c.kind, reference, v[lane]));
+        }
+    }
+    bool pass = worstScalar <= c.bound && worstVector <= c.bound;
+    std::printf("%-10s %-4s %12.3g %12.3g %12.3g  %s\n", c.name, kindNames[c.kind],
+                worstScalar, worstVector, c.bound, pass ? "ok" : "FAIL");
+    return pass;
+}
+
+} // namespace
+
+int runFastMathCheck() {
+    // pow and exp bounds grow with the magnitude of the exponent; sweep
+    // ranges keep that term at most ~10
+    const FastMathCase cases[] = {
+        {"exp2", -126.0, 127.0, ERROR_RELATIVE, 3e-7,
+         [](double x) { return std::exp2(x); },
+         [](float x) { return fm::exp2(x); },
+         [](simd::float_4 x) { return fm::exp2(x); }},
+        {"log2", 1e-30, 1e30, ERROR_MIXED, 1.5e-7,
+         [](double x) { return std::log2(x); },
+         [](float x) { return fm::log2(x); },
+         [](simd::float_4 x) { return fm::log2(x); }},
+        {"log2-unit", 0.5, 2.0, ERROR_ABSOLUTE, 1.5e-7,
+         [](double x) { return std::log2(x); },
+         [](float x) { return fm::log2(x); },
+         [](simd::float_4 x) { return fm::log2(x); }},
+        {"pow", 1e-3, 1.0, ERROR_RELATIVE, 3e-7 * (1.0 + 2.5 * 10.0),
+         [](double x) { return std::pow(x, 2.5); },
+         [](float x) { return fm::pow(x, 2.5f); },
+         [](simd::float_4 x) { return fm::pow(x, simd::float_4(2.5f)); }},
+        {"exp", -10.0, 10.0, ERROR_RELATIVE, 3e-7 * 11.0,
+         [](double x) { return std::exp(x); },
+         [](float x) { return fm::exp(x); },
+         [](simd::float_4 x) { return fm::exp(x); }},
+        {"tanh", -12.0, 12.0, ERROR_ABSOLUTE, 2e-7,
+         [](double x) { return std::tanh(x); },
+         [](float x) { return fm::tanh(x); },
+         [](simd::float_4 x) { return fm::tanh(x); }},
+        {"sin2pi", -4.0, 4.0, ERROR_ABSOLUTE, 2.5e-7,
+         [](double x) { return std::sin(2.0 * M_PI * x); },
+         [](float x) { return fm::sin2pi(x); },
+         [](simd::float_4 x) { return fm::sin2pi(x); }},
+        {"cos2pi", -4.0, 4.0, ERROR_ABSOLUTE, 2.5e-7,
+         [](double x) { return std::cos(2.0 * M_PI * x); },
+         [](float x) { return fm::cos2pi(x); },
+         [](simd::float_4 x) { return fm::cos2pi(x); }},
+        {"sin2pi-far", -65536.0, 65536.0, ERROR_ABSOLUTE, 2.5e-7,
+         [](double x) { return std::sin(2.0 * M_PI * x); },
+         [](float x) { return fm::sin2pi(x); },
+         [](simd::float_4 x) { return fm::sin2pi(x); }},
+    };
+
+    std::printf("%-10s %-4s %12s %12s %12s  %s\n", "function", "err", "scalar", "float_4", "bound", "result");
+    int failures = 0;
+    for (const FastMathCase& c : cases) {
+        if (!runCase(c)) {
+            failures++;
+        }
+    }
+    return failures == 0 ? 0 : 1;
+}
+
+}} // namespace shapetaker::bench
@@ -0,0 +1,330 @@
+// Golden-output regression runner.
+//
+// Renders the bench stimulus through every module and either records the
+// outputs as 32-bit float WAVs (one WAV channel per output port/poly channel)
+// or compares a fresh render against the stored references. Comparison
+// reports max absolute error, RMS error and a log-spectral distance so
+// optimizations that only perturb rounding (SIMD, tables, decimated control
+// paths) pass while audible changes fail.
+
+#include "harness.hpp"
+
+#include <cstdint>
+#include <cstdio>
+#include <cstring>
+
+namespace shapetaker {
+namespace bench {
+
+namespace {
+
+constexpr int kGoldenChannels = 2;
+constexpr float kGoldenSampleRate = 48000.f;
+constexpr int kFftSize = 2048;
+
+// ============================================================================
+// TOLERANCES
+// ============================================================================
+
+struct GoldenTolerance {
+    const char* module;
+    float maxAbs;     // volts
+    float rms;        // volts
+    float spectralDb; // mean log-spectral distance
+};
+
+// Every module renders the same deterministic stimulus from the same RNG seed
+// (ModuleDriver reseeds random::local()), so a reference differs from a fresh
+// render only by arithmetic. Each bound is float rounding (a few ulps per
+// sample, ~1e-6 V at 10 V) plus the approximation error of whatever the
+// module trades accuracy for, carried through to the output. The default is
+// the rounding floor for modules with no such trade.
+const GoldenTolerance kDefaultTolerance = {"", 1e-4f, 1e-5f, 0.05f};
+const GoldenTolerance kTolerances[] = {
+    // Phase accumulators: a 1-ulp change in the increment moves a 500 Hz saw
+    // edge ~0.01 sample after 2 s, ~0.1 V on the two edge samples per cycle.
+    // PowTable shape emphasis (1e-4) and eco crossfade/tanh (2.5e-7) stay
+    // below 2e-3 V.
+    {"Clairaudient", 0.15f, 0.01f, 0.2f},
+    // Same edge drift as Clairaudient. The PowTable warp (< 1.5e-3 for
+    // exponents >= 0.2) halves into the phase: 7.5e-4 cycles, 0.025 V at 5 V.
+    {"Torsion", 0.15f, 0.01f, 0.3f},
+    // Rendered in precise math (kGoldenData), so libm fixes the crusher's
+    // quantizer scale. Float rounding (~1e-6 V) then passes through at most
+    // 2x VCA and 4x makeup gain; any quantizer step that still moves (0.625 V)
+    // is a real change.
+    {"Chiaroscuro", 1e-3f, 1e-4f, 0.1f},
+    // The frequency shifter's rotator keeps rounding drift in its step: up to
+    // 6e-8 rad per sample, 6e-3 rad after 2 s, 0.03 V at 5 V. Padé prewarp
+    // (1e-8) and the simd::exp tanh (~1e-7) are far below that.
+    {"Involution", 0.05f, 5e-3f, 0.3f},
+    // Grain windows from a table (< 3e-6), recirculated through the mode and
+    // tank feedback (loop gain < 0.9, so at most 10x)
+    {"Reverie", 2e-3f, 2e-4f, 0.1f},
+    // A 1-ulp change in a modulated delay time (0.004 samples at 1 s) on the
+    // stimulus' 3 V saw edge is 0.012 V, then up to 4x through feedback
+    {"Tessellation", 0.05f, 2e-3f, 0.2f},
+    {"Tessellation-hermite", 0.05f, 2e-3f, 0.2f},
+    // Eco sin2pi/tanh (2.5e-7) in the morph LFOs and tape saturation
+    {"Chimera", 2e-3f, 2e-4f, 0.1f},
+    // Coefficients ramp 16 samples behind the sweep CV: 0.07% in frequency
+    // at the bench's fastest sweep, ~0.4% of a Q 2.5 band's output
+    {"Incantation", 0.03f, 3e-3f, 0.2f},
+    // The baked 2049-point envelope rounds each breakpoint corner by up to
+    // |slope change| * step / 4: 0.012 V for a 10 V attack over 10% of the
+    // envelope
+    {"Evocation", 0.02f, 1e-3f, 0.2f},
+    // Rendered in precise math (kGoldenData). Eco exp2 rates shift LFO wraps
+    // enough to move square, saw and sample-and-hold edges by a sample; with
+    // libm rates only phase rounding is left, 6e-8 cycles, 1e-6 V at 10 V.
+    {"Patina", 1e-4f, 1e-5f, 0.05f},
+    // PowTable envelope curves use exponents 1-3 (< 1e-4): 1e-3 V at 10 V.
+    // Triggers and gates fire on clock edges and seeded draws.
+    {"Fatebinder", 2e-3f, 2e-4f, 0.1f},
+    // No output ports: the reference is a single silent channel
+    {"NocturneTV", 0.f, 0.f, 0.f},
+};
+
+// Module JSON the golden render applies in place of the bench entry's
+// (null there), for modules whose eco math turns rounding into edge shifts
+struct GoldenData {
+    const char* module;
+    const char* dataJson;
+};
+
+const GoldenData kGoldenData[] = {
+    {"Chiaroscuro", "{\"preciseMath\": true}"},
+    {"Patina", "{\"preciseMath\": true}"},
+};
+
+const GoldenTolerance& toleranceFor(const std::string& module) {
+    for (const GoldenTolerance& tolerance : kTolerances) {
+        if (module == tolerance.module) {
+            return tolerance;
+        }
+    }
+    return kDefaultTolerance;
+}
+
+// ============================================================================
+// WAV I/O (IEEE float, little endian)
+// ============================================================================
+
+void writeU32(std::FILE* f, uint32_t v) {
+    std::fwrite(&v, 4, 1, f);
+}
+
+void writeU16(std::FILE* f, uint16_t v) {
+    std::fwrite(&v, 2, 1, f);
+}
+
+bool writeWav(const std::string& path, const std::vector<float>& samples, int channels, float sampleRate) {
+    std::FILE* f = std::fopen(path.c_str(), "wb");
+    if (!f) {
+        return false;
+    }
+    uint32_t dataBytes = (uint32_t)(samples.size() * sizeof(float));
+    std::fwrite("RIFF", 1, 4, f);
+    writeU32(f, 36 + dataBytes);
+    std::fwrite("WAVE", 1, 4, f);
+    std::fwrite("fmt ", 1, 4, f);
+    writeU32(f, 16);
+    writeU16(f, 3); // WAVE_FORMAT_IEEE_FLOAT
+    writeU16(f, (uint16_t)channels);
+    writeU32(f, (uint32_t)sampleRate);
+    writeU32(f, (uint32_t)(sampleRate * channels * sizeof(float)));
+    writeU16(f, (uint16_t)(channels * sizeof(float)));
+    writeU16(f, 32);
+    std::fwrite("data", 1, 4, f);
+    writeU32(f, dataBytes);
+    std::fwrite(samples.data(), sizeof(float), samples.size(), f);
+    bool ok = std::ferror(f) == 0;
+    std::fclose(f);
+    return ok;
+}
+
+bool readWav(const std::string& path, std::vector<float>& samples, int& channels) {
+    std::FILE* f = std::fopen(path.c_str(), "rb");
+    if (!f) {
+        return false;
+    }
+    char id[4];
+    uint32_t size = 0;
+    bool ok = std::fread(id, 1, 4, f) == 4 && std::memcmp(id, "RIFF", 4) == 0;
+    ok = ok && std::fread(&size, 4, 1, f) == 1;
+    ok = ok && std::fread(id, 1, 4, f) == 4 && std::memcmp(id, "WAVE", 4) == 0;
+
+    bool haveFormat = false;
+    while (ok && std::fread(id, 1, 4, f) == 4 && std::fread(&size, 4, 1, f) == 1) {
+        if (std::memcmp(id, "fmt ", 4) == 0) {
+            uint16_t format = 0;
+            uint16_t numChannels = 0;
+            ok = std::fread(&format, 2, 1, f) == 1 && std::fread(&numChannels, 2, 1, f) == 1;
+            ok = ok && format == 3 && numChannels > 0;
+            channels = numChannels;
+            haveFormat = ok;
+            std::fseek(f, (long)size - 4, SEEK_CUR);
+        } else if (std::memcmp(id, "data", 4) == 0) {
+            samples.resize(size / sizeof(float));
+            ok = haveFormat && std::fread(samples.data(), sizeof(float), samples.size(), f) == samples.size();
+            std::fclose(f);
+            return ok;
+        } else {
+            std::fseek(f, (long)size, SEEK_CUR);
+        }
+    }
+    std::fclose(f);
+    return false;
+}
+
+// ============================================================================
+// METRICS
+// ============================================================================
+
+struct GoldenMetrics {
+    float maxAbs = 0.f;
+    float rms = 0.f;
+    float spectralDb = 0.f;
+};
+
+// Mean log-spectral distance (dB) between two mono signals, Hann-windowed blocks
+float spectralDistance(const std::vector<float>& a, const std::vector<float>& b) {
+    static rack::dsp::RealFFT fft(kFftSize);
+    alignas(16) float inA[kFftSize];
+    alignas(16) float inB[kFftSize];
+    alignas(16) float outA[kFftSize];
+    alignas(16) float outB[kFftSize];
+    // Magnitudes below this (about -100 dB re 10 V full scale) count as silence
+    const float floorMag = 1e-4f * kFftSize;
+
+    size_t blocks = std::min(a.size(), b.size()) / kFftSize;
+    double total = 0.0;
+    for (size_t blk = 0; blk < blocks; ++blk) {
+        for (int i = 0; i < kFftSize; ++i) {
+            float window = 0.5f - 0.5f * std::cos(2.f * (float)M_PI * i / kFftSize);
+            inA[i] = a[blk * kFftSize + i] * window;
+            inB[i] = b[blk * kFftSize + i] * window;
+        }
+        fft.rfft(inA, outA);
+        fft.rfft(inB, outB);
+
+        // Ordered output: [DC, Nyquist, re1, im1, re2, im2, ...]
+        double sum = 0.0;
+        for (int k = 1; k < kFftSize / 2; ++k) {
+            float magA = std::hypot(outA[2 * k], outA[2 * k + 1]);
+            float magB = std::hypot(outB[2 * k], outB[2 * k + 1]);
+            double dbA = 20.0 * std::log10(std::max(magA, floorMag));
+            double dbB = 20.0 * std::log10(std::max(magB, floorMag));
+            sum += (dbA - dbB) * (dbA - dbB);
+        }
+        total += std::sqrt(sum / (kFftSize / 2 - 1));
+    }
+    return blocks > 0 ? (float)(total / blocks) : 0.f;
+}
+
+GoldenMetrics compare(const std::vector<float>& reference, const std::vector<float>& render, int channels) {
+    GoldenMetrics metrics;
+    size_t count = std::min(reference.size(), render.size());
+    double sumSq = 0.0;
+    for (size_t i = 0; i < count; ++i) {
+        float err = std::fabs(reference[i] - render[i]);
+        metrics.maxAbs = std::max(metrics.maxAbs, err);
+        sumSq += (double)err * err;
+    }
+    metrics.rms = count > 0 ? (float)std::sqrt(sumSq / count) : 0.f;
+
+    // Worst channel wins
+    size_t frames = count / channels;
+    std::vector<float> monoA(frames);
+    std::vector<float> monoB(frames);
+    for (int c = 0; c < channels; ++c) {
+        for (size_t f = 0; f < frames; ++f) {
+            monoA[f] = reference[f * channels + c];
+            monoB[f] = render[f * channels + c];
+        }
+        metrics.spectralDb = std::max(metrics.spectralDb, spectralDistance(monoA, monoB));
+    }
+    return metrics;
+}
+
+BenchModule goldenEntry(const BenchModule& entry) {
+    BenchModule golden = entry;
+    for (const GoldenData& data : kGoldenData) {
+        if (std::strcmp(entry.name, data.module) == 0) {
+            golden.dataJson = data.dataJson;
+        }
+    }
+    return golden;
+}
+
+std::vector<float> render(const BenchModule& entry, float seconds, int& stride) {
+    ModuleDriver driver(goldenEntry(entry), kGoldenChannels, kGoldenSampleRate);
+    stride = std::max(1, driver.getOutputStride());
+    const int64_t totalFrames = (int64_t)(seconds * kGoldenSampleRate);
+
+    std::vector<float> samples((size_t)totalFrames * stride, 0.f);
+    std::vector<float> block((size_t)kBlockFrames * stride, 0.f);
+    while (driver.getFrame() < totalFrames) {
+        int64_t start = driver.getFrame();
+        int frames = (int)std::min<int64_t>(kBlockFrames, totalFrames - start);
+        driver.prepareBlock(frames);
+        driver.processBlock(driver.getOutputStride() > 0 ? block.data() : nullptr);
+        std::copy(block.begin(), block.begin() + (size_t)frames * stride, samples.begin() + (size_t)start * stride);
+    }
+    return samples;
+}
+
+} // namespace
+
+int runGolden(const GoldenOptions& options) {
+    system::createDirectories(options.directory);
+
+    int failures = 0;
+    if (!options.record) {
+        std::printf("%-14s %12s %12s %12s  %s\n", "module", "max abs", "rms", "spectral dB", "result");
+    }
+    for (const BenchModule& entry : kBenchModules) {
+        if (!options.moduleFilter.empty() && options.moduleFilter != entry.name) {
+            continue;
+        }
+        std::string path = system::join(options.directory, std::string(entry.name) + ".wav");
+        int stride = 1;
+        std::vector<float> samples = render(entry, options.seconds, stride);
+
+        if (options.record) {
+            if (writeWav(path, samples, stride, kGoldenSampleRate)) {
+                std::printf("recorded %s (%d channels)\n", path.c_str(), stride);
+            } else {
+                std::fprintf(stderr, "failed to write %s\n", path.c_str());
+                failures++;
+            }
+            continue;
+        }
+
+        std::vector<float> reference;
+        int referenceChannels = 0;
+        if (!readWav(path, reference, referenceChannels)) {
+            std::printf("%-14s %12s %12s %12s  MISSING (make golden-record)\n", entry.name, "-", "-", "-");
+            failures++;
+            continue;
+        }
+        if (referenceChannels != stride || reference.size() != samples.size()) {
+            std::printf("%-14s %12s %12s %12s  LAYOUT CHANGED\n", entry.name, "-", "-", "-");
+            failures++;
+            continue;
+        }
+
+        GoldenMetrics metrics = compare(reference, samples, stride);
+        const GoldenTolerance& tolerance = toleranceFor(entry.name);
+        bool pass = metrics.maxAbs <= tolerance.maxAbs && metrics.rms <= tolerance.rms &&
+                    metrics.spectralDb <= tolerance.spectralDb;
+        std::printf("%-14s %12.3g %12.3g %12.3f  %s\n", entry.name, metrics.maxAbs, metrics.rms,
+                    metrics.spectralDb, pass ? "ok" : "FAIL");
+        if (!pass) {
+            failures++;
+        }
+    }
+    return failures == 0 ? 0 : 1;
+}
+
+}} // namespace shapetaker::bench
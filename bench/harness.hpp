@@ -0,0 +1,263 @@
+#pragma once
+#include "plugin.hpp"
+
+#include <algorithm>
+#include <cctype>
+#include <cmath>
+#include <cstdio>
+#include <cstdlib>
+#include <string>
+#include <vector>
+
+// Shared pieces of the headless bench: module table, deterministic stimulus
+// and a driver that runs one module instance block by block.
+
+namespace shapetaker {
+namespace bench {
+
+// ============================================================================
+// MODULE TABLE
+// ============================================================================
+
+struct BenchModule {
+    const char* name;
+    Model** model;
+    // Optional module JSON (as saved by dataToJson) applied after creation,
+    // for benchmarking context-menu variants of the same module
+    const char* dataJson;
+};
+
+// Every audio module except the passive utility panel, plus named variants.
+// Entries spell out all three fields; dataJson is nullptr for the defaults.
+static const BenchModule kBenchModules[] = {
+    {"Clairaudient", &modelClairaudient, nullptr},
+    {"Torsion", &modelTorsion, nullptr},
+    {"Chiaroscuro", &modelChiaroscuro, nullptr},
+    {"Involution", &modelInvolution, nullptr},
+    {"Reverie", &modelReverie, nullptr},
+    {"Tessellation", &modelTessellation, nullptr},
+    {"Tessellation-hermite", &modelTessellation, "{\"interpolation\": [1, 1, 1]}"},
+    {"Chimera", &modelChimera, nullptr},
+    {"Incantation", &modelIncantation, nullptr},
+    {"Evocation", &modelEvocation, nullptr},
+    {"Patina", &modelPatina, nullptr},
+    {"Fatebinder", &modelFatebinder, nullptr},
+    {"Transmutation", &modelTransmutation, nullptr},
+    {"Specula", &modelSpecula, nullptr},
+    {"NocturneTV", &modelNocturneTV, nullptr},
+};
+
+static constexpr int kMaxChannels = 6;
+static constexpr int kBlockFrames = 256;
+static constexpr uint64_t kSeed0 = 0x5348415045544b52ull;
+static constexpr uint64_t kSeed1 = 0x42454e4348303031ull;
+
+// ============================================================================
+// DETERMINISTIC INPUT SIGNALS
+// ============================================================================
+
+enum InputKind {
+    INPUT_AUDIO,
+    INPUT_PITCH,
+    INPUT_GATE,
+    INPUT_RESET,
+    INPUT_CV
+};
+
+inline bool nameContains(const std::string& name, const char* token) {
+    return name.find(token) != std::string::npos;
+}
+
+// Classify inputs by their configured name so every module gets sensible drive
+inline InputKind classifyInput(Module* module, int index) {
+    std::string name;
+    if (index < (int)module->inputInfos.size() && module->inputInfos[index]) {
+        name = module->inputInfos[index]->getName();
+    }
+    std::transform(name.begin(), name.end(), name.begin(), [](unsigned char c) {
+        return (char)std::tolower(c);
+    });
+
+    if (nameContains(name, "reset") || nameContains(name, "stop")) {
+        return INPUT_RESET;
+    }
+    if (nameContains(name, "gate") || nameContains(name, "trig") || nameContains(name, "clock") ||
+        nameContains(name, "start") || nameContains(name, "sync")) {
+        return INPUT_GATE;
+    }
+    if (nameContains(name, "v/oct") || nameContains(name, "voct") || nameContains(name, "pitch")) {
+        return INPUT_PITCH;
+    }
+    if (nameContains(name, "cv") || nameContains(name, "mod") || nameContains(name, "gesture")) {
+        return INPUT_CV;
+    }
+    return INPUT_AUDIO;
+}
+
+inline float inputVoltage(InputKind kind, int input, int channel, double time) {
+    switch (kind) {
+        case INPUT_PITCH: {
+            static const float notes[] = {0.f, 3.f, 7.f, 10.f, 12.f, 7.f, 5.f, -2.f};
+            int step = (int)(time * 4.0) & 7;
+            return (notes[step] + 7.f * channel) / 12.f - 1.f;
+        }
+        case INPUT_GATE: {
+            double phase = time * 2.0 + 0.13 * channel;
+            return (phase - std::floor(phase)) < 0.5 ? 10.f : 0.f;
+        }
+        case INPUT_RESET: {
+            double phase = time * 0.25 + 0.07 * channel;
+            return (phase - std::floor(phase)) < 0.002 ? 10.f : 0.f;
+        }
+        case INPUT_CV: {
+            double rate = 0.3 + 0.11 * input + 0.05 * channel;
+            return 2.f * (float)std::sin(2.0 * M_PI * rate * time);
+        }
+        case INPUT_AUDIO:
+        default: {
+            double freq = 110.0 * std::pow(2.0, input / 7.0 + channel / 12.0);
+            double phase = freq * time;
+            double saw = 2.0 * (phase - std::floor(phase)) - 1.0;
+            return (float)(3.5 * std::sin(2.0 * M_PI * phase) + 1.5 * saw);
+        }
+    }
+}
+
+// ============================================================================
+// MODULE DRIVER
+// ============================================================================
+
+/**
+ * Owns one module instance at a fixed channel count and sample rate.
+ * Stimulus is rendered a block ahead (prepareBlock) so callers can time
+ * processBlock() alone. The global RNG is reseeded on construction, which
+ * keeps noise-based modules reproducible between runs.
+ */
+class ModuleDriver {
+public:
+    ModuleDriver(const BenchModule& entry, int channels, float sampleRate)
+        : channels(channels) {
+        random::local().seed(kSeed0, kSeed1);
+        APP->engine->setSampleRate(sampleRate);
+
+        module = (*entry.model)->createModule();
+        if (entry.dataJson) {
+            json_error_t error;
+            json_t* dataJ = json_loads(entry.dataJson, 0, &error);
+            if (!dataJ) {
+                // A variant that silently runs the defaults would mislabel every result
+                std::fprintf(stderr, "%s: invalid dataJson: %s\n", entry.name, error.text);
+                std::exit(1);
+            }
+            module->dataFromJson(dataJ);
+            json_decref(dataJ);
+        }
+
+        Module::SampleRateChangeEvent sampleRateEvent;
+        sampleRateEvent.sampleRate = sampleRate;
+        sampleRateEvent.sampleTime = 1.f / sampleRate;
+        module->onSampleRateChange(sampleRateEvent);
+
+        numInputs = (int)module->inputs.size();
+        numOutputs = (int)module->outputs.size();
+        kinds.resize(numInputs);
+        for (int i = 0; i < numInputs; ++i) {
+            kinds[i] = classifyInput(module, i);
+            module->inputs[i].setChannels(channels);
+        }
+        for (Output& output : module->outputs) {
+            output.setChannels(channels);
+        }
+
+        args.sampleRate = sampleRate;
+        args.sampleTime = 1.f / sampleRate;
+        args.frame = 0;
+
+        frameStride = std::max(1, numInputs * channels);
+        block.resize((size_t)kBlockFrames * frameStride);
+    }
+
+    ~ModuleDriver() {
+        delete module;
+    }
+
+    // Output voltages per frame: every output port times the channel count
+    int getOutputStride() const {
+        return numOutputs * channels;
+    }
+
+    int64_t getFrame() const {
+        return frame;
+    }
+
+    void prepareBlock(int frames) {
+        blockFrames = rack::math::clamp(frames, 0, kBlockFrames);
+        for (int f = 0; f < blockFrames; ++f) {
+            double time = (frame + f) * (double)args.sampleTime;
+            float* voltages = &block[(size_t)f * frameStride];
+            for (int i = 0; i < numInputs; ++i) {
+                for (int c = 0; c < channels; ++c) {
+                    voltages[i * channels + c] = inputVoltage(kinds[i], i, c, time);
+                }
+            }
+        }
+    }
+
+    // Runs the prepared block; `out` (optional) receives blockFrames * getOutputStride() values
+    void processBlock(float* out = nullptr) {
+        for (int f = 0; f < blockFrames; ++f) {
+            const float* voltages = &block[(size_t)f * frameStride];
+            for (int i = 0; i < numInputs; ++i) {
+                for (int c = 0; c < channels; ++c) {
+                    module->inputs[i].setVoltage(voltages[i * channels + c], c);
+                }
+            }
+            args.frame = frame;
+            module->process(args);
+            ++frame;
+
+            if (out) {
+                for (int o = 0; o < numOutputs; ++o) {
+                    for (int c = 0; c < channels; ++c) {
+                        *out++ = module->outputs[o].getVoltage(c);
+                    }
+                }
+            }
+        }
+    }
+
+private:
+    Module* module = nullptr;
+    Module::ProcessArgs args;
+    std::vector<InputKind> kinds;
+    std::vector<float> block;
+    int channels = 1;
+    int numInputs = 0;
+    int numOutputs = 0;
+    int frameStride = 1;
+    int blockFrames = 0;
+    int64_t frame = 0;
+};
+
+// ============================================================================
+// GOLDEN-OUTPUT REGRESSION
+// ============================================================================
+
+struct GoldenOptions {
+    std::string directory = "bench/golden";
+    std::string moduleFilter;
+    bool record = false;
+    float seconds = 2.f;
+};
+
+// Renders every module and records or compares reference WAVs; returns the exit code
+int runGolden(const GoldenOptions& options);
+
+// ============================================================================
+// FASTMATH ACCURACY
+// ============================================================================
+
+// Checks src/dsp/fastmath.hpp against libm; returns the exit code
+int runFastMathCheck();
+
+}} // namespace shapetaker::bench
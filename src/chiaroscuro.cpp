@@ -1,4 +1,5 @@
 #include "plugin.hpp"
+#include "ui/menu_helpers.hpp"
 #include <dsp/digital.hpp>
 #include <dsp/filter.hpp>
 #include <cmath>
@@ -88,8 +89,7 @@ struct Chiaroscuro : Module {
     static constexpr int MIN_OVERSAMPLE_FACTOR = 1;
     static constexpr int MAX_OVERSAMPLE_FACTOR = 8;
     static constexpr int DEFAULT_OVERSAMPLE_FACTOR = 4;
-    static constexpr float OVERSAMPLE_LP1_CUTOFF_RATIO = 0.38f;
-    static constexpr float OVERSAMPLE_POLE_RATIO = 0.55f;
+    static constexpr float SLEEP_TAIL_SECONDS = 0.05f;   // covers the oversampler and dry-path latency
     static constexpr int   DISTORTION_TYPE_COUNT    = 6; // hard clip, tube sat, wave fold, bit crush, destroy, ring mod
     static constexpr float TYPE_CV_SPAN = static_cast<float>(DISTORTION_TYPE_COUNT);
     static constexpr int MAX_DISTORTION_TYPE_INDEX = DISTORTION_TYPE_COUNT - 1;
@@ -100,63 +100,6 @@ struct Chiaroscuro : Module {
         SIDECHAIN_DIRECT = 2
     };
 
-    struct OversampleState {
-        int factor = 1;
-        bool bypass = true;
-        float prevInput = 0.0f;
-        float lp1 = 0.0f;
-        float lp2 = 0.0f;
-        float lp3 = 0.0f;
-        float a1 = 0.0f;
-        float b1 = 0.0f;
-        float a2 = 0.0f;
-        float b2 = 0.0f;
-        float a3 = 0.0f;
-        float b3 = 0.0f;
-
-        void configure(float baseSampleRate, int newFactor) {
-            factor = rack::math::clamp(newFactor, Chiaroscuro::MIN_OVERSAMPLE_FACTOR, Chiaroscuro::MAX_OVERSAMPLE_FACTOR);
-            bypass = (factor <= Chiaroscuro::MIN_OVERSAMPLE_FACTOR);
-            if (bypass) {
-                a1 = b1 = a2 = b2 = a3 = b3 = 0.0f;
-                return;
-            }
-
-            float oversampleRate = baseSampleRate * factor;
-            float cutoff = baseSampleRate * Chiaroscuro::OVERSAMPLE_LP1_CUTOFF_RATIO; // Keep below Nyquist with more attenuation
-            float alpha1 = expf(-2.0f * M_PI * cutoff / oversampleRate);
-            a1 = 1.0f - alpha1;
-            b1 = alpha1;
-
-            float cutoff2 = cutoff * Chiaroscuro::OVERSAMPLE_POLE_RATIO; // Slightly lower for second pole
-            float alpha2 = expf(-2.0f * M_PI * cutoff2 / oversampleRate);
-            a2 = 1.0f - alpha2;
-            b2 = alpha2;
-
-            float cutoff3 = cutoff2 * Chiaroscuro::OVERSAMPLE_POLE_RATIO; // Third pole for extra rejection
-            float alpha3 = expf(-2.0f * M_PI * cutoff3 / oversampleRate);
-            a3 = 1.0f - alpha3;
-            b3 = alpha3;
-        }
-
-        void reset() {
-            prevInput = 0.0f;
-            lp1 = 0.0f;
-            lp2 = 0.0f;
-            lp3 = 0.0f;
-        }
-
-        float filter(float input) {
-            if (bypass) {
-                return input;
-            }
-            lp1 = a1 * input + b1 * lp1;
-            lp2 = a2 * lp1 + b2 * lp2;
-            lp3 = a3 * lp2 + b3 * lp3;
-            return lp3;
-        }
-    };
-
     shapetaker::PolyphonicProcessor polyProcessor;
     shapetaker::SidechainDetector detector;
     shapetaker::VoiceArray<shapetaker::DistortionEngine> distortion_l, distortion_r;
@@ -189,8 +132,25 @@ struct Chiaroscuro : Module {
     shapetaker::FloatVoices makeupGainL;
     shapetaker::FloatVoices makeupGainR;
 
-    std::array<OversampleState, shapetaker::PolyphonicProcessor::MAX_VOICES> oversampleStateL{};
-    std::array<OversampleState, shapetaker::PolyphonicProcessor::MAX_VOICES> oversampleStateR{};
+    // Halfband up/down sampling around the distortion stage
+    shapetaker::VoiceArray<shapetaker::dsp::Oversampler> oversamplerL;
+    shapetaker::VoiceArray<shapetaker::dsp::Oversampler> oversamplerR;
+    // Clean signal delayed by the oversampler round trip, so the mix does not comb
+    shapetaker::VoiceArray<shapetaker::dsp::LatencyDelay> dryDelayL;
+    shapetaker::VoiceArray<shapetaker::dsp::LatencyDelay> dryDelayR;
+
+    // Vectorized path: each group's float_4 lanes hold {L, R} of two voices,
+    // or four voices when L and R carry the same signal
+    static constexpr int SIMD_GROUPS = shapetaker::PolyphonicProcessor::MAX_VOICES / 2;
+    std::array<shapetaker::dsp::DistortionEngine4, SIMD_GROUPS> distortionGroups;
+    std::array<shapetaker::dsp::Oversampler4, SIMD_GROUPS> oversamplerGroups;
+    std::array<shapetaker::dsp::LatencyDelay4, SIMD_GROUPS> dryDelayGroups;
+    std::array<simd::float_4, SIMD_GROUPS> cleanLevelGroups;
+    std::array<simd::float_4, SIMD_GROUPS> wetLevelGroups;
+    std::array<simd::float_4, SIMD_GROUPS> makeupGainGroups;
+
+    // LED and display smoothing run at control rate
+    shapetaker::dsp::ControlRateTicker ledTicker;
 
     // Rate-of-change tracking for adaptive smoothing
     float prev_distortion = 0.0f;
@@ -208,6 +168,17 @@ struct Chiaroscuro : Module {
     // Sidechain mode (context menu): enhancement, ducking, direct
     int sidechainMode = SIDECHAIN_ENHANCEMENT;
     int oversampleFactor = DEFAULT_OVERSAMPLE_FACTOR;
+    int oversampleQuality = shapetaker::dsp::Oversampler::QUALITY_STANDARD;
+    // Context menu: linear-phase FIR halfbands; more latency, but the dry path lines up exactly
+    bool linearPhase = false;
+    // Context menu: libm transcendentals instead of fastmath in the distortion
+    shapetaker::dsp::MathModeSetting mathSetting;
+    shapetaker::dsp::MathMode math;  // what the engines currently run with
+    // Context menu: run the vectorized voice loop; the scalar loop is kept as the reference
+    bool simdDistortion = true;
+    // Context menu: skip the voice loop once input and output are silent
+    bool sleepWhenSilent = true;
+    shapetaker::dsp::SilenceSleep silence;
     float currentSampleRate = DEFAULT_SAMPLE_RATE;
 
     Chiaroscuro() {
@@ -267,11 +238,16 @@ struct Chiaroscuro : Module {
         wetLevelR.reset();
         makeupGainL.forEach([](float& g) { g = 1.0f; });
         makeupGainR.forEach([](float& g) { g = 1.0f; });
-        for (auto& state : oversampleStateL) {
-            state.reset();
-        }
-        for (auto& state : oversampleStateR) {
-            state.reset();
+        oversamplerL.forEach([](shapetaker::dsp::Oversampler& os) { os.reset(); });
+        oversamplerR.forEach([](shapetaker::dsp::Oversampler& os) { os.reset(); });
+        dryDelayL.forEach([](shapetaker::dsp::LatencyDelay& delay) { delay.reset(); });
+        dryDelayR.forEach([](shapetaker::dsp::LatencyDelay& delay) { delay.reset(); });
+        for (int g = 0; g < SIMD_GROUPS; ++g) {
+            cleanLevelGroups[g] = 0.f;
+            wetLevelGroups[g] = 0.f;
+            makeupGainGroups[g] = 1.f;
+            oversamplerGroups[g].reset();
+            dryDelayGroups[g].reset();
         }
     }
 
@@ -287,12 +263,15 @@ struct Chiaroscuro : Module {
         auto coeffForHz = [sampleTime](float hz) {
             return 1.0f - expf(-2.0f * M_PI * hz * sampleTime);
         };
-        displaySmoothFast = coeffForHz(DISPLAY_SMOOTH_FAST_HZ);
-        displaySmoothSlow = coeffForHz(DISPLAY_SMOOTH_SLOW_HZ);
         controlSmoothCoeff = coeffForHz(CONTROL_SMOOTH_HZ);
         typeSmoothCoeff = coeffForHz(TYPE_SMOOTH_HZ);
-        levelSmoothCoeff = displaySmoothFast;
+        levelSmoothCoeff = coeffForHz(DISPLAY_SMOOTH_FAST_HZ);
         makeupSmoothCoeff = coeffForHz(MAKEUP_SMOOTH_HZ);
+
+        // Display smoothers advance once per LED tick
+        float tickTime = sampleTime * ledTicker.getDivision();
+        displaySmoothFast = 1.0f - expf(-2.0f * M_PI * DISPLAY_SMOOTH_FAST_HZ * tickTime);
+        displaySmoothSlow = 1.0f - expf(-2.0f * M_PI * DISPLAY_SMOOTH_SLOW_HZ * tickTime);
     }
 
     void configureOversampling() {
@@ -303,16 +282,35 @@ struct Chiaroscuro : Module {
         distortion_r.forEach([oversampleRate](shapetaker::DistortionEngine& engine) {
             engine.setSampleRate(oversampleRate);
         });
-        for (auto& state : oversampleStateL) {
-            state.configure(currentSampleRate, oversampleFactor);
+        const int factor = oversampleFactor;
+        const int quality = oversampleQuality;
+        const bool linear = linearPhase;
+        oversamplerL.forEach([=](shapetaker::dsp::Oversampler& os) { os.configure(factor, quality, linear); });
+        oversamplerR.forEach([=](shapetaker::dsp::Oversampler& os) { os.configure(factor, quality, linear); });
+        for (int g = 0; g < SIMD_GROUPS; ++g) {
+            distortionGroups[g].setSampleRate(oversampleRate);
+            oversamplerGroups[g].configure(factor, quality, linear);
         }
-        for (auto& state : oversampleStateR) {
-            state.configure(currentSampleRate, oversampleFactor);
+
+        // Exact with linear phase; the IIR stages' DC group delay, rounded, otherwise
+        const int latency = getLatencySamples();
+        dryDelayL.forEach([=](shapetaker::dsp::LatencyDelay& delay) { delay.setDelay(latency); });
+        dryDelayR.forEach([=](shapetaker::dsp::LatencyDelay& delay) { delay.setDelay(latency); });
+        for (shapetaker::dsp::LatencyDelay4& delay : dryDelayGroups) {
+            delay.setDelay(latency);
         }
     }
 
+    // Output delay added by oversampling, in samples at the engine rate
+    int getLatencySamples() const {
+        if (oversampleFactor <= MIN_OVERSAMPLE_FACTOR)
+            return 0;
+        return (int)std::round(oversamplerGroups[0].getLatency());
+    }
+
     void setOversampleFactor(int factor) {
-        factor = rack::math::clamp(factor, MIN_OVERSAMPLE_FACTOR, MAX_OVERSAMPLE_FACTOR);
+        factor = shapetaker::dsp::Oversampler::sanitizeFactor(
+            rack::math::clamp(factor, MIN_OVERSAMPLE_FACTOR, MAX_OVERSAMPLE_FACTOR));
         if (factor == oversampleFactor)
             return;
         oversampleFactor = factor;
@@ -320,10 +318,42 @@ struct Chiaroscuro : Module {
         resetLevelTracking();
     }
 
+    void setOversampleQuality(int quality) {
+        quality = rack::math::clamp(quality, 0, shapetaker::dsp::Oversampler::QUALITY_COUNT - 1);
+        if (quality == oversampleQuality)
+            return;
+        oversampleQuality = quality;
+        configureOversampling();
+        resetLevelTracking();
+    }
+
+    void setLinearPhase(bool linear) {
+        if (linear == linearPhase)
+            return;
+        linearPhase = linear;
+        configureOversampling();
+        resetLevelTracking();
+    }
+
+    // Audio thread: hands a changed setting to every distortion engine
+    void applyPreciseMath(bool precise) {
+        distortion_l.forEach([precise](shapetaker::DistortionEngine& engine) { engine.setPreciseMath(precise); });
+        distortion_r.forEach([precise](shapetaker::DistortionEngine& engine) { engine.setPreciseMath(precise); });
+        for (shapetaker::dsp::DistortionEngine4& engine : distortionGroups) {
+            engine.setPreciseMath(precise);
+        }
+        math.precise = precise;
+    }
+
     json_t* dataToJson() override {
         json_t* rootJ = json_object();
         json_object_set_new(rootJ, "sidechainMode", json_integer(sidechainMode));
         json_object_set_new(rootJ, "oversampleFactor", json_integer(oversampleFactor));
+        json_object_set_new(rootJ, "oversampleQuality", json_integer(oversampleQuality));
+        json_object_set_new(rootJ, "linearPhase", json_boolean(linearPhase));
+        mathSetting.dataToJson(rootJ);
+        json_object_set_new(rootJ, "simdDistortion", json_boolean(simdDistortion));
+        json_object_set_new(rootJ, "sleepWhenSilent", json_boolean(sleepWhenSilent));
         return rootJ;
     }
 
@@ -336,6 +366,23 @@ struct Chiaroscuro : Module {
             int factor = json_integer_value(oversampleJ);
             setOversampleFactor(factor);
         }
+        json_t* qualityJ = json_object_get(rootJ, "oversampleQuality");
+        if (qualityJ) {
+            setOversampleQuality(json_integer_value(qualityJ));
+        }
+        json_t* linearPhaseJ = json_object_get(rootJ, "linearPhase");
+        if (linearPhaseJ) {
+            setLinearPhase(json_boolean_value(linearPhaseJ));
+        }
+        mathSetting.dataFromJson(rootJ);
+        json_t* simdDistortionJ = json_object_get(rootJ, "simdDistortion");
+        if (simdDistortionJ) {
+            simdDistortion = json_boolean_value(simdDistortionJ);
+        }
+        json_t* sleepWhenSilentJ = json_object_get(rootJ, "sleepWhenSilent");
+        if (sleepWhenSilentJ) {
+            sleepWhenSilent = json_boolean_value(sleepWhenSilentJ);
+        }
     }
 
     static inline float clampUnit(float v) {
@@ -355,6 +402,11 @@ struct Chiaroscuro : Module {
     }
 
     void process(const ProcessArgs& args) override {
+        bool precise = mathSetting.isPrecise();
+        if (precise != math.precise) {
+            applyPreciseMath(precise);
+        }
+
         // Update polyphonic channel count and set outputs (use max of L/R for full stereo poly)
         int channels = polyProcessor.updateChannels(
             {inputs[AUDIO_L_INPUT], inputs[AUDIO_R_INPUT]},
@@ -369,7 +421,10 @@ struct Chiaroscuro : Module {
         sidechain = clampUnit(fabsf(sidechain) * CV_TO_UNIT_SCALE);
         
         float sc_env = detector.process(sidechain);
-        lights[SIDECHAIN_LED].setBrightness(sc_env);
+        bool ledTick = ledTicker.tick(args.sampleTime);
+        if (ledTick) {
+            lights[SIDECHAIN_LED].setBrightness(sc_env);
+        }
         
         // Global parameters (shared across all voices)
         // Drive parameter with CV (smoothed to avoid zippering)
@@ -459,100 +514,162 @@ struct Chiaroscuro : Module {
         processed_drive = drive;
         processed_mix = mix;
 
-        // Apply adaptive smoothing to display values to prevent audio-rate flickering
-        // Calculate rate of change for each parameter
-        float dist_rate = fabsf(processed_distortion - prev_distortion) / args.sampleTime;
-        float drive_rate = fabsf(processed_drive - prev_drive) / args.sampleTime;
-        float mix_rate = fabsf(processed_mix - prev_mix) / args.sampleTime;
-
-        // Update previous values
-        prev_distortion = processed_distortion;
-        prev_drive = processed_drive;
-        prev_mix = processed_mix;
-
-        // Adaptive cutoff frequency: good response up to 10Hz, then averaging above
-        // Rate threshold of ~6.28 corresponds to 10Hz sine wave at full amplitude
-        float dist_smooth_factor = (dist_rate > RATE_THRESHOLD_HZ10) ? displaySmoothSlow : displaySmoothFast;
-        float drive_smooth_factor = (drive_rate > RATE_THRESHOLD_HZ10) ? displaySmoothSlow : displaySmoothFast;
-        float mix_smooth_factor = (mix_rate > RATE_THRESHOLD_HZ10) ? displaySmoothSlow : displaySmoothFast;
-
-        smoothed_distortion_display += (processed_distortion - smoothed_distortion_display) * dist_smooth_factor;
-        smoothed_drive_display += (processed_drive - smoothed_drive_display) * drive_smooth_factor;
-        smoothed_mix_display += (processed_mix - smoothed_mix_display) * mix_smooth_factor;
-
         // The actual distortion amount used in processing - use effective drive for sidechain mode
         float distortion_amount = smoothed_distortion * effective_drive;
 
-        // Distortion LED: product-based (reflects actual distortion heard) plus
-        // a small peak hint so any single knob at ~half shows a subtle glow
-        float product = smoothed_distortion_display * smoothed_drive_display * smoothed_mix_display;
-        float peak = std::max(smoothed_distortion_display, std::max(smoothed_drive_display, smoothed_mix_display));
-        float dist_intensity = clampUnit(product + peak * peak * LED_INTENSITY_PEAK_HINT);
-        // Boost brightness while keeping darker base hues; allow >1.0 pre-clamp for stronger glow.
-        float dist_led_brightness = std::pow(dist_intensity, LED_BRIGHTNESS_GAMMA) * LED_BRIGHTNESS_BOOST;
-
-        // Color palette for each distortion type (normalized RGB)
-        float dist_r = 0.26f;
-        float dist_g = 0.34f;
-        float dist_b = 0.46f;
-        getDistortionTypeColor(distortion_type, dist_r, dist_g, dist_b);
-
-        // Apply brightness to the type color, clamping per channel for LED intensity
-        shapetaker::RGBColor currentLEDColor(
-            clampUnit(dist_r * dist_led_brightness),
-            clampUnit(dist_g * dist_led_brightness),
-            clampUnit(dist_b * dist_led_brightness));
-
-        lights[DIST_LED_R].setBrightness(currentLEDColor.r);
-        lights[DIST_LED_G].setBrightness(currentLEDColor.g);
-        lights[DIST_LED_B].setBrightness(currentLEDColor.b);
+        if (ledTick) {
+            // Apply adaptive smoothing to display values to prevent audio-rate flickering
+            // Calculate rate of change for each parameter
+            float dist_rate = fabsf(processed_distortion - prev_distortion) / ledTicker.getElapsed();
+            float drive_rate = fabsf(processed_drive - prev_drive) / ledTicker.getElapsed();
+            float mix_rate = fabsf(processed_mix - prev_mix) / ledTicker.getElapsed();
+
+            // Update previous values
+            prev_distortion = processed_distortion;
+            prev_drive = processed_drive;
+            prev_mix = processed_mix;
+
+            // Adaptive cutoff frequency: good response up to 10Hz, then averaging above
+            // Rate threshold of ~6.28 corresponds to 10Hz sine wave at full amplitude
+            float dist_smooth_factor = (dist_rate > RATE_THRESHOLD_HZ10) ? displaySmoothSlow : displaySmoothFast;
+            float drive_smooth_factor = (drive_rate > RATE_THRESHOLD_HZ10) ? displaySmoothSlow : displaySmoothFast;
+            float mix_smooth_factor = (mix_rate > RATE_THRESHOLD_HZ10) ? displaySmoothSlow : displaySmoothFast;
+
+            smoothed_distortion_display += (processed_distortion - smoothed_distortion_display) * dist_smooth_factor;
+            smoothed_drive_display += (processed_drive - smoothed_drive_display) * drive_smooth_factor;
+            smoothed_mix_display += (processed_mix - smoothed_mix_display) * mix_smooth_factor;
+
+            // Distortion LED: product-based (reflects actual distortion heard) plus
+            // a small peak hint so any single knob at ~half shows a subtle glow
+            float product = smoothed_distortion_display * smoothed_drive_display * smoothed_mix_display;
+            float peak = std::max(smoothed_distortion_display, std::max(smoothed_drive_display, smoothed_mix_display));
+            float dist_intensity = clampUnit(product + peak * peak * LED_INTENSITY_PEAK_HINT);
+            // Boost brightness while keeping darker base hues; allow >1.0 pre-clamp for stronger glow.
+            float dist_led_brightness = std::pow(dist_intensity, LED_BRIGHTNESS_GAMMA) * LED_BRIGHTNESS_BOOST;
+
+            // Color palette for each distortion type (normalized RGB)
+            float dist_r = 0.26f;
+            float dist_g = 0.34f;
+            float dist_b = 0.46f;
+            getDistortionTypeColor(distortion_type, dist_r, dist_g, dist_b);
+
+            // Apply brightness to the type color, clamping per channel for LED intensity
+            shapetaker::RGBColor currentLEDColor(
+                clampUnit(dist_r * dist_led_brightness),
+                clampUnit(dist_g * dist_led_brightness),
+                clampUnit(dist_b * dist_led_brightness));
+
+            lights[DIST_LED_R].setBrightness(currentLEDColor.r);
+            lights[DIST_LED_G].setBrightness(currentLEDColor.g);
+            lights[DIST_LED_B].setBrightness(currentLEDColor.b);
+        }
         
         // VCA gain calculation (polyphonic CV support)
         float base_vca_gain = params[VCA_PARAM].getValue();
         bool exponential_response = params[RESPONSE_PARAM].getValue() > SWITCH_ON_THRESHOLD;
         
-        const float normalizationVoltage = NOMINAL_LEVEL;
-        const float invNormalization = 1.0f / normalizationVoltage;
-        float gain_led_peak = 0.0f;
+        float inputPeak = std::max(shapetaker::dsp::portPeak(inputs[AUDIO_L_INPUT]),
+                                   shapetaker::dsp::portPeak(inputs[AUDIO_R_INPUT]));
+        silence.setEnabled(sleepWhenSilent);
+        silence.setTailSeconds(SLEEP_TAIL_SECONDS);
 
-        // Process each voice
-        for (int ch = 0; ch < channels; ch++) {
-            // Per-voice VCA gain calculation
-            float vca_gain = base_vca_gain;
-            
-            if (inputs[VCA_CV_INPUT].isConnected()) {
+        if (silence.asleep(inputPeak)) {
+            // Distorters, oversamplers and dry delays hold their state until input returns
+            for (int ch = 0; ch < channels; ch++) {
+                outputs[AUDIO_L_OUTPUT].setVoltage(0.0f, ch);
+                outputs[AUDIO_R_OUTPUT].setVoltage(0.0f, ch);
+            }
+        } else {
+            if (simdDistortion) {
+                processVoicesSimd(channels, linked, base_vca_gain, exponential_response,
+                                  distortion_amount, smoothed_type, effective_mix);
+            } else {
+                processVoicesScalar(channels, linked, base_vca_gain, exponential_response,
+                                    distortion_amount, distortion_type, effective_mix);
+            }
+            float outputPeak = std::max(shapetaker::dsp::portPeak(outputs[AUDIO_L_OUTPUT]),
+                                        shapetaker::dsp::portPeak(outputs[AUDIO_R_OUTPUT]));
+            silence.observe(std::max(inputPeak, outputPeak), args.sampleTime);
+        }
+
+        if (!ledTick) {
+            return;
+        }
+
+        // Gain LED: Show effective VCA gain (knob + CV) with teal color
+        float gain_cv_level = 0.0f;
+        if (inputs[VCA_CV_INPUT].isConnected()) {
+            // Use maximum effective gain across all channels
+            for (int ch = 0; ch < channels; ch++) {
                 float cv = normalizeCV10V(inputs[VCA_CV_INPUT].getPolyVoltage(ch));
                 cv = clamp(cv, BIPOLAR_MIN, BIPOLAR_MAX);
-                vca_gain += cv; // Direct CV control without attenuverter
+                float effective_gain = clamp(base_vca_gain + cv, UNIT_MIN, UNIT_MAX);
+                gain_cv_level = fmaxf(gain_cv_level, effective_gain);
             }
-            
-            vca_gain = clamp(vca_gain, UNIT_MIN, VCA_GAIN_MAX);
+        } else {
+            // No CV connected - show knob position (0-1 range maps directly)
+            gain_cv_level = clamp(base_vca_gain, UNIT_MIN, UNIT_MAX);
+        }
 
-            // Apply response curve
-            if (exponential_response) {
-                vca_gain = vca_gain * vca_gain; // Square for exponential
-            }
+        // Teal color for gain LED (matches Channel A theme)
+        // Use sqrt for better low-end visibility
+        float gain_brightness = clamp(std::sqrt(gain_cv_level), UNIT_MIN, UNIT_MAX);
+        float ledTime = ledTicker.getElapsed();
+        lights[GAIN_LED_R].setSmoothBrightness(0.0f, ledTime);
+        lights[GAIN_LED_G].setSmoothBrightness(gain_brightness, ledTime);
+        lights[GAIN_LED_B].setSmoothBrightness(gain_brightness * GAIN_LED_BLUE_SCALE, ledTime);
+    }
+
+    // VCA, hot-signal aggression and pre-drive boost for one voice
+    void computeVoiceInput(int ch, bool linked, float base_vca_gain, bool exponential_response,
+                           float& vca_l, float& vca_r, float& pre_drive_boost) {
+        // Per-voice VCA gain calculation
+        float vca_gain = base_vca_gain;
+
+        if (inputs[VCA_CV_INPUT].isConnected()) {
+            float cv = normalizeCV10V(inputs[VCA_CV_INPUT].getPolyVoltage(ch));
+            cv = clamp(cv, BIPOLAR_MIN, BIPOLAR_MAX);
+            vca_gain += cv; // Direct CV control without attenuverter
+        }
+
+        vca_gain = clamp(vca_gain, UNIT_MIN, VCA_GAIN_MAX);
+
+        // Apply response curve
+        if (exponential_response) {
+            vca_gain = vca_gain * vca_gain; // Square for exponential
+        }
+
+        // No automatic polyphonic normalization here; leave gain as-is
+
+        // Get audio inputs for this voice
+        float input_l = inputs[AUDIO_L_INPUT].getPolyVoltage(ch);
+        float input_r = linked ? input_l :
+                       (inputs[AUDIO_R_INPUT].isConnected() ? inputs[AUDIO_R_INPUT].getPolyVoltage(ch) : input_l);
+
+        float base_vca_l = input_l * vca_gain;
+        float base_vca_r = input_r * vca_gain;
+
+        float openFactor = clamp((vca_gain - VCA_OPEN_START) / VCA_OPEN_RANGE, UNIT_MIN, UNIT_MAX);
+        float signalPeak = fmaxf(fabsf(base_vca_l), fabsf(base_vca_r));
+        float hotSignal = clamp((signalPeak - HOT_SIGNAL_START_V) / HOT_SIGNAL_RANGE_V, UNIT_MIN, UNIT_MAX);
+        float aggression = openFactor * hotSignal;
+        float aggression_gain = 1.0f + aggression * AGGRESSION_GAIN_SCALE;
+        pre_drive_boost = 1.0f + aggression * PRE_DRIVE_BOOST_SCALE;
+
+        vca_l = base_vca_l * aggression_gain;
+        vca_r = base_vca_r * aggression_gain;
+    }
+
+    // Reference voice loop: one scalar DistortionEngine per voice and side
+    void processVoicesScalar(int channels, bool linked, float base_vca_gain, bool exponential_response,
+                             float distortion_amount, int distortion_type, float effective_mix) {
+        const float normalizationVoltage = NOMINAL_LEVEL;
+        const float invNormalization = 1.0f / normalizationVoltage;
+
+        for (int ch = 0; ch < channels; ch++) {
+            float vca_l, vca_r, pre_drive_boost;
+            computeVoiceInput(ch, linked, base_vca_gain, exponential_response, vca_l, vca_r, pre_drive_boost);
 
-            // No automatic polyphonic normalization here; leave gain as-is
-            
-            // Get audio inputs for this voice
-            float input_l = inputs[AUDIO_L_INPUT].getPolyVoltage(ch);
-            float input_r = linked ? input_l : 
-                           (inputs[AUDIO_R_INPUT].isConnected() ? inputs[AUDIO_R_INPUT].getPolyVoltage(ch) : input_l);
-            
-            float base_vca_l = input_l * vca_gain;
-            float base_vca_r = input_r * vca_gain;
-
-            float openFactor = clamp((vca_gain - VCA_OPEN_START) / VCA_OPEN_RANGE, UNIT_MIN, UNIT_MAX);
-            float signalPeak = fmaxf(fabsf(base_vca_l), fabsf(base_vca_r));
-            float hotSignal = clamp((signalPeak - HOT_SIGNAL_START_V) / HOT_SIGNAL_RANGE_V, UNIT_MIN, UNIT_MAX);
-            float aggression = openFactor * hotSignal;
-            float aggression_gain = 1.0f + aggression * AGGRESSION_GAIN_SCALE;
-            float pre_drive_boost = 1.0f + aggression * PRE_DRIVE_BOOST_SCALE;
-
-            float vca_l = base_vca_l * aggression_gain;
-            float vca_r = base_vca_r * aggression_gain;
-            
             // Process distortion for this voice
             float normalized_l = (vca_l * pre_drive_boost) * invNormalization;
             float normalized_r = (vca_r * pre_drive_boost) * invNormalization;
@@ -565,54 +682,43 @@ struct Chiaroscuro : Module {
                                                    (shapetaker::DistortionEngine::Type)distortion_type);
                 wetNormR = distortion_r[ch].process(normalized_r, distortion_amount,
                                                    (shapetaker::DistortionEngine::Type)distortion_type);
-                oversampleStateL[ch].prevInput = normalized_l;
-                oversampleStateR[ch].prevInput = normalized_r;
             } else {
-                auto& osL = oversampleStateL[ch];
-                auto& osR = oversampleStateR[ch];
-                float prevL = osL.prevInput;
-                float prevR = osR.prevInput;
-                float accumL = 0.0f;
-                float accumR = 0.0f;
-                const int factor = oversampleFactor;
-                const float step = 1.0f / static_cast<float>(factor);
-
+                // Band-limited upsampling keeps images out of the distorter; the
+                // matching decimator rejects the harmonics it generates above Nyquist.
+                float bufL[shapetaker::dsp::Oversampler::MAX_FACTOR];
+                float bufR[shapetaker::dsp::Oversampler::MAX_FACTOR];
+                oversamplerL[ch].upsample(normalized_l, bufL);
+                oversamplerR[ch].upsample(normalized_r, bufR);
+
+                const int factor = oversamplerL[ch].getFactor();
                 for (int os = 0; os < factor; ++os) {
-                    float t = (os + 1) * step;
-                    float interpL = rack::math::crossfade(prevL, normalized_l, t);
-                    float interpR = rack::math::crossfade(prevR, normalized_r, t);
-
-                    float distortedL = distortion_l[ch].process(
-                        interpL, distortion_amount,
+                    bufL[os] = distortion_l[ch].process(
+                        bufL[os], distortion_amount,
                         (shapetaker::DistortionEngine::Type)distortion_type);
-                    float distortedR = distortion_r[ch].process(
-                        interpR, distortion_amount,
+                    bufR[os] = distortion_r[ch].process(
+                        bufR[os], distortion_amount,
                         (shapetaker::DistortionEngine::Type)distortion_type);
-
-                    accumL += osL.filter(distortedL);
-                    accumR += osR.filter(distortedR);
                 }
 
-                osL.prevInput = normalized_l;
-                osR.prevInput = normalized_r;
-                wetNormL = accumL * step;
-                wetNormR = accumR * step;
+                wetNormL = oversamplerL[ch].downsample(bufL);
+                wetNormR = oversamplerR[ch].downsample(bufR);
             }
 
             float wet_l = wetNormL * normalizationVoltage;
             float wet_r = wetNormR * normalizationVoltage;
+            float dry_l = dryDelayL[ch].process(vca_l);
+            float dry_r = dryDelayR[ch].process(vca_r);
 
             // Track RMS-like envelopes for wet/dry signals
-            float cleanAbsL = fabsf(vca_l);
+            float cleanAbsL = fabsf(dry_l);
             float wetAbsL = fabsf(wet_l);
             cleanLevelL[ch] += (cleanAbsL - cleanLevelL[ch]) * levelSmoothCoeff;
             wetLevelL[ch] += (wetAbsL - wetLevelL[ch]) * levelSmoothCoeff;
 
-            float cleanAbsR = fabsf(vca_r);
+            float cleanAbsR = fabsf(dry_r);
             float wetAbsR = fabsf(wet_r);
             cleanLevelR[ch] += (cleanAbsR - cleanLevelR[ch]) * levelSmoothCoeff;
             wetLevelR[ch] += (wetAbsR - wetLevelR[ch]) * levelSmoothCoeff;
-            gain_led_peak = fmaxf(gain_led_peak, fmaxf(cleanLevelL[ch], cleanLevelR[ch]));
 
             float desiredGainL = 1.0f;
             float desiredGainR = 1.0f;
@@ -634,8 +740,8 @@ struct Chiaroscuro : Module {
 
             // Mix between clean and distorted signals - use effective mix for sidechain mode
             // Simple linear crossfade with slight boost to compensate for wet/dry balance
-            float output_l = vca_l * (1.0f - effective_mix) + compensated_l * effective_mix;
-            float output_r = vca_r * (1.0f - effective_mix) + compensated_r * effective_mix;
+            float output_l = dry_l * (1.0f - effective_mix) + compensated_l * effective_mix;
+            float output_r = dry_r * (1.0f - effective_mix) + compensated_r * effective_mix;
 
             // Apply gentle makeup gain at higher mix values to compensate for level drop
             // +1.5dB at 100% mix to maintain consistent loudness
@@ -672,28 +778,84 @@ struct Chiaroscuro : Module {
             outputs[AUDIO_L_OUTPUT].setVoltage(output_l, ch);
             outputs[AUDIO_R_OUTPUT].setVoltage(output_r, ch);
         }
+    }
 
-        // Gain LED: Show effective VCA gain (knob + CV) with teal color
-        float gain_cv_level = 0.0f;
-        if (inputs[VCA_CV_INPUT].isConnected()) {
-            // Use maximum effective gain across all channels
-            for (int ch = 0; ch < channels; ch++) {
-                float cv = normalizeCV10V(inputs[VCA_CV_INPUT].getPolyVoltage(ch));
-                cv = clamp(cv, BIPOLAR_MIN, BIPOLAR_MAX);
-                float effective_gain = clamp(base_vca_gain + cv, UNIT_MIN, UNIT_MAX);
-                gain_cv_level = fmaxf(gain_cv_level, effective_gain);
+    // Vectorized voice loop. The distortion type is a continuous position, so
+    // neighbouring types crossfade while smoothed_type moves.
+    void processVoicesSimd(int channels, bool linked, float base_vca_gain, bool exponential_response,
+                           float distortion_amount, float type_position, float effective_mix) {
+        using float_4 = simd::float_4;
+        const float invNormalization = 1.0f / NOMINAL_LEVEL;
+        // Identical L/R inputs give identical L/R outputs, so one lane per voice will do
+        const bool monoPack = linked || !inputs[AUDIO_R_INPUT].isConnected();
+        const int voicesPerGroup = monoPack ? 4 : 2;
+        const int groups = (channels + voicesPerGroup - 1) / voicesPerGroup;
+        const float width = params[WIDTH_PARAM].getValue();
+        const float mix_makeup = 1.0f + effective_mix * MIX_MAKEUP_SCALE;
+
+        for (int g = 0; g < groups; ++g) {
+            const int firstVoice = g * voicesPerGroup;
+            const int voices = std::min(voicesPerGroup, channels - firstVoice);
+
+            float_4 clean = 0.f;
+            float_4 normalized = 0.f;
+            for (int v = 0; v < voices; ++v) {
+                float vca_l, vca_r, pre_drive_boost;
+                computeVoiceInput(firstVoice + v, linked, base_vca_gain, exponential_response,
+                                  vca_l, vca_r, pre_drive_boost);
+                if (monoPack) {
+                    clean[v] = vca_l;
+                    normalized[v] = vca_l * pre_drive_boost * invNormalization;
+                } else {
+                    clean[2 * v] = vca_l;
+                    clean[2 * v + 1] = vca_r;
+                    normalized[2 * v] = vca_l * pre_drive_boost * invNormalization;
+                    normalized[2 * v + 1] = vca_r * pre_drive_boost * invNormalization;
+                }
             }
-        } else {
-            // No CV connected - show knob position (0-1 range maps directly)
-            gain_cv_level = clamp(base_vca_gain, UNIT_MIN, UNIT_MAX);
-        }
 
-        // Teal color for gain LED (matches Channel A theme)
-        // Use sqrt for better low-end visibility
-        float gain_brightness = clamp(std::sqrt(gain_cv_level), UNIT_MIN, UNIT_MAX);
-        lights[GAIN_LED_R].setSmoothBrightness(0.0f, args.sampleTime);
-        lights[GAIN_LED_G].setSmoothBrightness(gain_brightness, args.sampleTime);
-        lights[GAIN_LED_B].setSmoothBrightness(gain_brightness * GAIN_LED_BLUE_SCALE, args.sampleTime);
+            float_4 wetNorm;
+            if (oversampleFactor <= MIN_OVERSAMPLE_FACTOR) {
+                wetNorm = normalized;
+                distortionGroups[g].process(&wetNorm, 1, distortion_amount, type_position);
+            } else {
+                float_4 buf[shapetaker::dsp::Oversampler4::MAX_FACTOR];
+                oversamplerGroups[g].upsample(normalized, buf);
+                distortionGroups[g].process(buf, oversamplerGroups[g].getFactor(), distortion_amount, type_position);
+                wetNorm = oversamplerGroups[g].downsample(buf);
+            }
+            float_4 wet = wetNorm * NOMINAL_LEVEL;
+            clean = dryDelayGroups[g].process(clean);
+
+            // Wet/dry envelopes and auto makeup gain
+            cleanLevelGroups[g] += (simd::fabs(clean) - cleanLevelGroups[g]) * levelSmoothCoeff;
+            wetLevelGroups[g] += (simd::fabs(wet) - wetLevelGroups[g]) * levelSmoothCoeff;
+            float_4 measurable = (wetLevelGroups[g] > MAKEUP_MIN_LEVEL) & (cleanLevelGroups[g] > MAKEUP_MIN_LEVEL);
+            float_4 desiredGain = simd::ifelse(measurable, cleanLevelGroups[g] / wetLevelGroups[g], 1.0f);
+            desiredGain = simd::clamp(desiredGain, MAKEUP_GAIN_MIN, MAKEUP_GAIN_MAX);
+            makeupGainGroups[g] += (desiredGain - makeupGainGroups[g]) * makeupSmoothCoeff;
+
+            float_4 output = clean * (1.0f - effective_mix) + wet * makeupGainGroups[g] * effective_mix;
+            output *= mix_makeup;
+            // NaN fails the comparison too
+            output = simd::ifelse(simd::fabs(output) < INFINITY, output, 0.0f);
+
+            if (!monoPack && width != 0.0f) {
+                // Mid/side per {L, R} lane pair: side is (L - R) / 2 on L lanes, (R - L) / 2 on R lanes
+                float_4 swapped(output[1], output[0], output[3], output[2]);
+                float_4 mid = (output + swapped) * 0.5f;
+                float_4 side = (output - swapped) * 0.5f;
+                output = mid + side * (1.0f + width);
+            }
+
+            output = OUTPUT_HEADROOM * math.tanh(output * (1.0f / OUTPUT_HEADROOM));
+
+            for (int v = 0; v < voices; ++v) {
+                int ch = firstVoice + v;
+                outputs[AUDIO_L_OUTPUT].setVoltage(output[monoPack ? v : 2 * v], ch);
+                outputs[AUDIO_R_OUTPUT].setVoltage(output[monoPack ? v : 2 * v + 1], ch);
+            }
+        }
     }
 
 private:
@@ -723,6 +885,18 @@ struct ChiaroscuroWidget : ShapetakerModuleWidget {
         menu->addChild(createCheckMenuItem("1x", "", [=]{ return module->oversampleFactor == 1; }, [=]{ module->setOversampleFactor(1); }));
         menu->addChild(createCheckMenuItem("2x", "", [=]{ return module->oversampleFactor == 2; }, [=]{ module->setOversampleFactor(2); }));
         menu->addChild(createCheckMenuItem("4x", "", [=]{ return module->oversampleFactor == 4; }, [=]{ module->setOversampleFactor(4); }));
+        menu->addChild(createCheckMenuItem("8x", "", [=]{ return module->oversampleFactor == 8; }, [=]{ module->setOversampleFactor(8); }));
+        menu->addChild(createSubmenuItem("Filter Quality", "", [=](Menu* subMenu) {
+            subMenu->addChild(createCheckMenuItem("Eco", "", [=]{ return module->oversampleQuality == shapetaker::dsp::Oversampler::QUALITY_ECO; }, [=]{ module->setOversampleQuality(shapetaker::dsp::Oversampler::QUALITY_ECO); }));
+            subMenu->addChild(createCheckMenuItem("Standard", "", [=]{ return module->oversampleQuality == shapetaker::dsp::Oversampler::QUALITY_STANDARD; }, [=]{ module->setOversampleQuality(shapetaker::dsp::Oversampler::QUALITY_STANDARD); }));
+            subMenu->addChild(createCheckMenuItem("High", "", [=]{ return module->oversampleQuality == shapetaker::dsp::Oversampler::QUALITY_HIGH; }, [=]{ module->setOversampleQuality(shapetaker::dsp::Oversampler::QUALITY_HIGH); }));
+        }));
+        menu->addChild(createCheckMenuItem("Linear Phase", "", [=]{ return module->linearPhase; }, [=]{ module->setLinearPhase(!module->linearPhase); }));
+        menu->addChild(createMenuLabel(string::f("Latency: %d samples", module->getLatencySamples())));
+        menu->addChild(createCheckMenuItem("Vectorized Distortion", "", [=]{ return module->simdDistortion; }, [=]{ module->simdDistortion = !module->simdDistortion; }));
+        menu->addChild(createCheckMenuItem("Sleep When Silent", "", [=]{ return module->sleepWhenSilent; }, [=]{ module->sleepWhenSilent = !module->sleepWhenSilent; }));
+
+        menu->addChild(shapetaker::ui::createPreciseMathItem(&module->mathSetting));
 
         menu->addChild(new MenuSeparator);
         menu->addChild(createMenuLabel("Sidechain Mode"));
@@ -1,8 +1,11 @@
 #include "plugin.hpp"
 #include "ui/layout.hpp"
+#include "ui/menu_helpers.hpp"
 #include "dsp/polyphony.hpp"
+#include "dsp/loop_storage.hpp"
 
 #include <array>
+#include <atomic>
 #include <cmath>
 #include <vector>
 
@@ -12,7 +15,13 @@ namespace chimera {
     }
 
     constexpr float MAX_LOOP_SECONDS = 32.f;
+    // Page tables are sized for this rate; faster engines get shorter loops
+    constexpr float MAX_LOOP_SAMPLE_RATE = 192000.f;
+    // Pages are committed this far ahead of the record head
+    constexpr float LOOP_LOOKAHEAD_SECONDS = 1.f;
     constexpr float DEFAULT_BPM = 120.f;
+    // Morph slot and tilt filters are one-pole smoothers; this outlasts them
+    constexpr float SLEEP_TAIL_SECONDS = 0.1f;
 }
 
 struct Chimera : Module {
@@ -96,8 +105,7 @@ struct Chimera : Module {
         };
 
         State state = State::Idle;
-        std::vector<float> bufferL;
-        std::vector<float> bufferR;
+        shapetaker::dsp::PagedLoopStorage storage;
         size_t recordIndex = 0;
         size_t playIndex = 0;
         size_t targetSamples = 0;
@@ -158,7 +166,7 @@ struct Chimera : Module {
         }
 
         void process(float& left, float& right, float rateParam, float depthParam,
-                     float textureParam, float sampleTime) {
+                     float textureParam, float sampleTime, const shapetaker::dsp::MathMode& math) {
             float rateHz = 0.15f + rack::math::clamp(rateParam, 0.f, 1.f) * 5.0f;
             float depth = rack::math::clamp(depthParam, 0.f, 1.f);
             float texture = rack::math::clamp(textureParam, 0.f, 1.f);
@@ -168,8 +176,8 @@ struct Chimera : Module {
             phase2 += rateHz * (1.35f + 0.4f * texture) * sampleTime;
             if (phase2 >= 1.f) phase2 -= 1.f;
 
-            float lfoA = std::sin(2.f * float(M_PI) * phase);
-            float lfoB = std::sin(2.f * float(M_PI) * phase2);
+            float lfoA = math.sin2pi(phase);
+            float lfoB = math.sin2pi(phase2);
 
             auto allpass = [](float input, float coeff, float& state) {
                 float y = -coeff * input + state;
@@ -177,8 +185,8 @@ struct Chimera : Module {
                 return y;
             };
 
-            auto tapeSat = [](float x, float drive) {
-                return std::tanh(x * (1.f + drive * 1.2f));
+            auto tapeSat = [&math](float x, float drive) {
+                return math.tanh(x * (1.f + drive * 1.2f));
             };
 
             if (flavor == Flavor::Argent) {
@@ -339,6 +347,17 @@ struct Chimera : Module {
 
     float sampleRate = 44100.f;
     size_t maxLoopSamples = 0;
+    size_t loopLookaheadSamples = 0;
+
+    // Loop pages are committed and freed off the audio thread (serviceLoopStorage)
+    std::atomic<int> loopSampleFormat{shapetaker::dsp::LOOP_FORMAT_FLOAT32};
+    // Morph slot LFOs and tape saturation: fastmath (eco) or libm (precise)
+    shapetaker::dsp::MathModeSetting mathSetting;
+    // Context menu: skip the channel strips, morph slots and glue once everything is silent
+    std::atomic<bool> sleepWhenSilent{true};
+    shapetaker::dsp::SilenceSleep silence;
+    // Bumped at the start of every process(); gates freeing of released pages
+    std::atomic<uint64_t> audioEpoch{0};
 
     Chimera() {
         config(PARAMS_LEN, INPUTS_LEN, OUTPUTS_LEN, LIGHTS_LEN);
@@ -421,6 +440,9 @@ struct Chimera : Module {
             slotAVoices[v].setFlavor(MorphSlot::Flavor::Argent);
             slotBVoices[v].setFlavor(MorphSlot::Flavor::Aurum);
         }
+        for (auto& track : loopTracks) {
+            track.storage.setCapacity(static_cast<size_t>(chimera::MAX_LOOP_SECONDS * chimera::MAX_LOOP_SAMPLE_RATE));
+        }
 
         onSampleRateChange();
     }
@@ -445,15 +467,62 @@ struct Chimera : Module {
         clockState.timeSinceLastTick = 0.f;
         clockState.effectiveBpm = rack::math::clamp(params[CLOCK_BPM_PARAM].getValue(), 40.f, 200.f);
         maxLoopSamples = std::max<size_t>(1, static_cast<size_t>(chimera::MAX_LOOP_SECONDS * sampleRate));
+        maxLoopSamples = std::min(maxLoopSamples, loopTracks[0].storage.getCapacity());
+        loopLookaheadSamples = static_cast<size_t>(chimera::LOOP_LOOKAHEAD_SECONDS * sampleRate);
         for (auto& track : loopTracks) {
-            track.bufferL.assign(maxLoopSamples, 0.f);
-            track.bufferR.assign(maxLoopSamples, 0.f);
+            track.storage.requestRelease();
             track.reset();
         }
     }
 
+    // UI thread (module widget step, or process() when headless): commits
+    // pages ahead of recording tracks and frees those of idle tracks.
+    void serviceLoopStorage() {
+        uint64_t epoch = audioEpoch.load();
+        int format = loopSampleFormat.load();
+        for (auto& track : loopTracks) {
+            track.storage.setFormat(format);
+            track.storage.service(epoch);
+        }
+    }
+
+    size_t getLoopMemoryBytes() const {
+        size_t bytes = 0;
+        for (const auto& track : loopTracks) {
+            bytes += track.storage.getCommittedBytes();
+        }
+        return bytes;
+    }
+
+    json_t* dataToJson() override {
+        json_t* rootJ = json_object();
+        json_object_set_new(rootJ, "loopSampleFormat", json_integer(loopSampleFormat.load()));
+        mathSetting.dataToJson(rootJ);
+        json_object_set_new(rootJ, "sleepWhenSilent", json_boolean(sleepWhenSilent.load()));
+        return rootJ;
+    }
+
+    void dataFromJson(json_t* rootJ) override {
+        json_t* formatJ = json_object_get(rootJ, "loopSampleFormat");
+        if (formatJ) {
+            loopSampleFormat.store(rack::math::clamp((int)json_integer_value(formatJ),
+                0, shapetaker::dsp::LOOP_FORMAT_COUNT - 1));
+        }
+        mathSetting.dataFromJson(rootJ);
+        json_t* sleepWhenSilentJ = json_object_get(rootJ, "sleepWhenSilent");
+        if (sleepWhenSilentJ) {
+            sleepWhenSilent.store(json_boolean_value(sleepWhenSilentJ));
+        }
+    }
+
     void process(const ProcessArgs& args) override {
         const float sampleTime = args.sampleTime;
+        audioEpoch.fetch_add(1);
+        shapetaker::dsp::MathMode math;
+        mathSetting.apply(math);
+        if (settings::headless) {
+            serviceLoopStorage();
+        }
 
         float bpmParam = rack::math::clamp(params[CLOCK_BPM_PARAM].getValue(), 40.f, 200.f);
         bool clockRun = params[CLOCK_RUN_PARAM].getValue() > 0.5f;
@@ -528,6 +597,25 @@ struct Chimera : Module {
         }
         voiceCount = rack::math::clamp(voiceCount, 1, kMaxPoly);
 
+        // Clock and click keep running while asleep. An armed or running
+        // looper holds the mixer awake so a take never starts late.
+        float inputPeak = std::fabs(clickContribution);
+        bool loopsBusy = anyLoopActive;
+        for (int ch = 0; ch < kNumChannels; ++ch) {
+            inputPeak = std::max(inputPeak, shapetaker::dsp::portPeak(inputs[CH_INPUT_L + ch]));
+            inputPeak = std::max(inputPeak, shapetaker::dsp::portPeak(inputs[CH_INPUT_R + ch]));
+            loopsBusy |= params[CH_LOOP_ARM_PARAM + ch].getValue() > 0.5f;
+        }
+        silence.setEnabled(sleepWhenSilent.load(std::memory_order_relaxed));
+        silence.setTailSeconds(chimera::SLEEP_TAIL_SECONDS);
+        if (loopsBusy) {
+            silence.wake();
+        }
+        if (silence.asleep(inputPeak)) {
+            writeSilence(voiceCount);
+            return;
+        }
+
         std::array<std::array<float, kMaxPoly>, kNumChannels> channelVoiceOutL{};
         std::array<std::array<float, kMaxPoly>, kNumChannels> channelVoiceOutR{};
         std::array<float, kNumChannels> channelAggregateL{};
@@ -621,6 +709,7 @@ struct Chimera : Module {
             if (!loopArmed) {
                 if (loop.state != LoopTrack::State::Idle) {
                     loop.reset();
+                    loop.storage.requestRelease();
                 }
             } else {
                 if (loop.state == LoopTrack::State::Idle) {
@@ -628,7 +717,9 @@ struct Chimera : Module {
                 }
                 if (loop.state == LoopTrack::State::Armed) {
                     float thresholdVoltage = rack::math::clamp(params[CH_LOOP_THRESHOLD_PARAM + ch].getValue(), 0.01f, 1.f) * 5.f;
-                    if (loop.detector >= thresholdVoltage) {
+                    // Hold off until the first pages are committed so the take starts intact
+                    bool storageReady = loop.storage.isReady(std::min(loopTargetSamples, loopLookaheadSamples));
+                    if (storageReady && loop.detector >= thresholdVoltage) {
                         loop.state = LoopTrack::State::Recording;
                         loop.recordIndex = 0;
                         loop.playIndex = 0;
@@ -640,9 +731,8 @@ struct Chimera : Module {
 
             if (loop.state == LoopTrack::State::Recording) {
                 size_t limit = std::min(loop.targetSamples, maxLoopSamples);
-                if (loop.recordIndex < limit && loop.recordIndex < loop.bufferL.size()) {
-                    loop.bufferL[loop.recordIndex] = channelAggregateL[ch];
-                    loop.bufferR[loop.recordIndex] = channelAggregateR[ch];
+                if (loop.recordIndex < limit) {
+                    loop.storage.write(loop.recordIndex, channelAggregateL[ch], channelAggregateR[ch]);
                     loop.recordIndex++;
                 }
                 if (loop.recordIndex >= limit || !loopArmed) {
@@ -659,9 +749,25 @@ struct Chimera : Module {
                 }
             }
 
+            switch (loop.state) {
+                case LoopTrack::State::Armed:
+                    loop.storage.setRequiredFrames(std::min(loopTargetSamples, loopLookaheadSamples));
+                    break;
+                case LoopTrack::State::Recording:
+                    loop.storage.setRequiredFrames(std::min(loop.targetSamples, loop.recordIndex + loopLookaheadSamples));
+                    break;
+                case LoopTrack::State::Playing:
+                    loop.storage.setRequiredFrames(loop.lengthSamples);
+                    break;
+                default:
+                    loop.storage.setRequiredFrames(0);
+                    break;
+            }
+
             if (loop.state == LoopTrack::State::Playing && loop.lengthSamples > 0) {
-                float loopL = loop.bufferL[loop.playIndex];
-                float loopR = loop.bufferR[loop.playIndex];
+                float loopL = 0.f;
+                float loopR = 0.f;
+                loop.storage.read(loop.playIndex, loopL, loopR);
                 loop.playIndex = (loop.playIndex + 1) % loop.lengthSamples;
 
                 channelAggregateL[ch] = loopL;
@@ -753,9 +859,9 @@ struct Chimera : Module {
 
         for (int voice = 0; voice < voiceCount; ++voice) {
             slotAVoices[voice].process(morphSendAL[voice], morphSendAR[voice],
-                                       slotARate, slotADepth, slotATexture, sampleTime);
+                                       slotARate, slotADepth, slotATexture, sampleTime, math);
             slotBVoices[voice].process(morphSendBL[voice], morphSendBR[voice],
-                                       slotBRate, slotBDepth, slotBTexture, sampleTime);
+                                       slotBRate, slotBDepth, slotBTexture, sampleTime, math);
 
             float morphL = rack::math::crossfade(morphSendAL[voice], morphSendBL[voice], morphMaster);
             float morphR = rack::math::crossfade(morphSendAR[voice], morphSendBR[voice], morphMaster);
@@ -786,11 +892,15 @@ struct Chimera : Module {
             mixOutR[voice] = mixR;
         }
 
+        float outputPeak = 0.f;
         outputs[OUT_L_OUTPUT].setChannels(voiceCount);
         outputs[OUT_R_OUTPUT].setChannels(voiceCount);
         for (int voice = 0; voice < voiceCount; ++voice) {
             outputs[OUT_L_OUTPUT].setVoltage(mixOutL[voice], voice);
             outputs[OUT_R_OUTPUT].setVoltage(mixOutR[voice], voice);
+            outputPeak = std::max(outputPeak, std::max(std::fabs(mixOutL[voice]), std::fabs(mixOutR[voice])));
+            outputPeak = std::max(outputPeak, std::max(std::fabs(morphSendAL[voice]), std::fabs(morphSendAR[voice])));
+            outputPeak = std::max(outputPeak, std::max(std::fabs(morphSendBL[voice]), std::fabs(morphSendBR[voice])));
         }
 
         int morphVoices = std::min(voiceCount, kMaxPoly / 2);
@@ -802,6 +912,24 @@ struct Chimera : Module {
             outputs[MORPH_B_OUTPUT].setVoltage(morphSendBL[voice], 2 * voice);
             outputs[MORPH_B_OUTPUT].setVoltage(morphSendBR[voice], 2 * voice + 1);
         }
+        silence.observe(std::max(inputPeak, outputPeak), sampleTime);
+    }
+
+    // Mix and morph outputs while asleep, with the channel counts process() would set
+    void writeSilence(int voiceCount) {
+        int morphVoices = std::min(voiceCount, kMaxPoly / 2);
+        outputs[OUT_L_OUTPUT].setChannels(voiceCount);
+        outputs[OUT_R_OUTPUT].setChannels(voiceCount);
+        outputs[MORPH_A_OUTPUT].setChannels(morphVoices * 2);
+        outputs[MORPH_B_OUTPUT].setChannels(morphVoices * 2);
+        for (int voice = 0; voice < voiceCount; ++voice) {
+            outputs[OUT_L_OUTPUT].setVoltage(0.f, voice);
+            outputs[OUT_R_OUTPUT].setVoltage(0.f, voice);
+        }
+        for (int c = 0; c < morphVoices * 2; ++c) {
+            outputs[MORPH_A_OUTPUT].setVoltage(0.f, c);
+            outputs[MORPH_B_OUTPUT].setVoltage(0.f, c);
+        }
     }
 
     size_t getLoopTargetSamples() {
@@ -817,6 +945,39 @@ struct Chimera : Module {
 };
 
 struct ChimeraWidget : ModuleWidget {
+    void step() override {
+        if (auto* chimera = dynamic_cast<Chimera*>(module)) {
+            chimera->serviceLoopStorage();
+        }
+        ModuleWidget::step();
+    }
+
+    void appendContextMenu(Menu* menu) override {
+        Chimera* module = dynamic_cast<Chimera*>(this->module);
+        if (!module)
+            return;
+
+        menu->addChild(new MenuSeparator);
+        menu->addChild(createMenuLabel("Looper"));
+        menu->addChild(createSubmenuItem("Loop sample format", "", [=](Menu* sub) {
+            static const char* labels[] = {"32-bit float", "16-bit float", "16-bit integer"};
+            for (int i = 0; i < shapetaker::dsp::LOOP_FORMAT_COUNT; ++i) {
+                sub->addChild(createCheckMenuItem(labels[i], "",
+                    [=]{ return module->loopSampleFormat.load() == i; },
+                    [=]{ module->loopSampleFormat.store(i); }));
+            }
+            sub->addChild(createMenuLabel("Takes effect on disarmed tracks"));
+        }));
+        menu->addChild(createMenuLabel(string::f("Loop memory: %.1f MB",
+            module->getLoopMemoryBytes() / (1024.f * 1024.f))));
+
+        menu->addChild(new MenuSeparator);
+        menu->addChild(shapetaker::ui::createPreciseMathItem(&module->mathSetting));
+        menu->addChild(createCheckMenuItem("Sleep when silent", "",
+            [=]{ return module->sleepWhenSilent.load(); },
+            [=]{ module->sleepWhenSilent.store(!module->sleepWhenSilent.load()); }));
+    }
+
     // Match the uniform Clairaudient/Tessellation/Transmutation/Torsion leather treatment
     void draw(const DrawArgs& args) override {
         std::shared_ptr<Image> bg = APP->window->loadImage(asset::plugin(pluginInstance, "res/panels/panel_background.png"));
@@ -18,7 +18,6 @@ struct ClairaudientModule : Module, IOscilloscopeSource {
     static constexpr float OUTPUT_GAIN            = 5.f;
     static constexpr float NOISE_V_PEAK           = 0.45f;
     static constexpr float HIGH_CUT_HZ            = 14500.f;
-    static constexpr float ANTI_ALIAS_CUTOFF      = 0.45f;
     static constexpr float UINT32_NORM            = 1.f / 4294967296.f; // 1 / 2^32
     // Frequency parameter ranges
     static constexpr float FREQ1_OCT_MIN          = -2.f;
@@ -119,11 +118,9 @@ struct ClairaudientModule : Module, IOscilloscopeSource {
     std::atomic<int> oscilloscopeBufferIndex = {0};
     int oscilloscopeFrameCounter = 0;
 
-    // Anti-aliasing filters per voice (6 voices)
-    shapetaker::dsp::VoiceArray<shapetaker::dsp::OnePoleLowpass, MAX_POLY_VOICES> antiAliasFilterLeft;
-    shapetaker::dsp::VoiceArray<shapetaker::dsp::OnePoleLowpass, MAX_POLY_VOICES> antiAliasFilterRight;
-    shapetaker::dsp::VoiceArray<shapetaker::dsp::OnePoleLowpass, MAX_POLY_VOICES> antiAliasFilterLeftStage2;
-    shapetaker::dsp::VoiceArray<shapetaker::dsp::OnePoleLowpass, MAX_POLY_VOICES> antiAliasFilterRightStage2;
+    // Halfband decimators per voice (6 voices) bring the oversampled oscillators back to the engine rate
+    shapetaker::dsp::VoiceArray<shapetaker::dsp::Oversampler, MAX_POLY_VOICES> decimatorLeft;
+    shapetaker::dsp::VoiceArray<shapetaker::dsp::Oversampler, MAX_POLY_VOICES> decimatorRight;
     shapetaker::dsp::VoiceArray<shapetaker::dsp::OnePoleLowpass, MAX_POLY_VOICES> highCutFilterLeft;
     shapetaker::dsp::VoiceArray<shapetaker::dsp::OnePoleLowpass, MAX_POLY_VOICES> highCutFilterRight;
 
@@ -141,10 +138,15 @@ struct ClairaudientModule : Module, IOscilloscopeSource {
     std::atomic<int> crossfadeMode = {CROSSFADE_EQUAL_POWER};
     std::atomic<int> waveformMode = {WAVEFORM_SIGMOID_SAW};
     std::atomic<int> oversampleFactor = {4};
+    std::atomic<int> oversampleQuality = {shapetaker::dsp::Oversampler::QUALITY_STANDARD};
     std::atomic<bool> highCutEnabled = {false};
     std::atomic<float> driftAmount = {0.0f};
     std::atomic<int> oscilloscopeTheme = {shapetaker::ui::ThemeManager::DisplayTheme::PHOSPHOR};
     std::atomic<bool> pendingFilterReset = {false};
+    // Run the four oscillators of each voice in float_4 lanes; the scalar path is kept as the reference
+    std::atomic<bool> simdOscillators = {true};
+    // libm for the crossfade and output saturation instead of fastmath
+    shapetaker::dsp::MathModeSetting mathSetting;
 
     // Parameter decimation for performance (update every N samples instead of every sample)
     static constexpr int kParamDecimation = 32;  // ~0.7ms at 44.1kHz - imperceptible latency
@@ -183,10 +185,10 @@ struct ClairaudientModule : Module, IOscilloscopeSource {
     mutable int oscilloscopeReadIndex = 0;
 
     // Cached filter coefficients to avoid recompute every sample
-    float cachedAntiAliasAlpha = 0.f;
     float cachedHighCutAlpha = 0.f;
     float cachedSampleRate = 0.f;
     int cachedOversample = 0;
+    int cachedOversampleQuality = -1;
     bool cachedHighCutEnabled = false;
 
     // Per-voice PRNG state for fast drift/noise updates
@@ -206,25 +208,22 @@ struct ClairaudientModule : Module, IOscilloscopeSource {
     }
 
     void resetFilters() {
-        antiAliasFilterLeft.reset();
-        antiAliasFilterRight.reset();
-        antiAliasFilterLeftStage2.reset();
-        antiAliasFilterRightStage2.reset();
+        decimatorLeft.forEach([](shapetaker::dsp::Oversampler& os) { os.reset(); });
+        decimatorRight.forEach([](shapetaker::dsp::Oversampler& os) { os.reset(); });
         highCutFilterLeft.reset();
         highCutFilterRight.reset();
     }
 
-    void updateFilterCoefficients(float sampleRate, int oversample, bool highCut) {
+    void updateFilterCoefficients(float sampleRate, int oversample, int quality, bool highCut) {
         cachedSampleRate = sampleRate;
-        cachedOversample = oversample;
         cachedHighCutEnabled = highCut;
 
-        if (oversample > 1) {
-            float oversampleRate = sampleRate * oversample;
-            float antiAliasCutoffHz = sampleRate * ANTI_ALIAS_CUTOFF;
-            cachedAntiAliasAlpha = shapetaker::dsp::OnePoleLowpass::computeAlpha(antiAliasCutoffHz, oversampleRate);
-        } else {
-            cachedAntiAliasAlpha = 0.f;
+        if (oversample != cachedOversample || quality != cachedOversampleQuality) {
+            cachedOversample = oversample;
+            cachedOversampleQuality = quality;
+            // Halfband designs are normalized to the base rate, so only factor/quality changes need new coefficients
+            decimatorLeft.forEach([=](shapetaker::dsp::Oversampler& os) { os.configure(oversample, quality); os.reset(); });
+            decimatorRight.forEach([=](shapetaker::dsp::Oversampler& os) { os.configure(oversample, quality); os.reset(); });
         }
 
         cachedHighCutAlpha = (highCut ? shapetaker::dsp::OnePoleLowpass::computeAlpha(HIGH_CUT_HZ, sampleRate) : 0.f);
@@ -362,9 +361,12 @@ struct ClairaudientModule : Module, IOscilloscopeSource {
         json_object_set_new(rootJ, "crossfadeMode", json_integer(crossfadeMode.load(std::memory_order_relaxed)));
         json_object_set_new(rootJ, "waveformMode", json_integer(waveformMode.load(std::memory_order_relaxed)));
         json_object_set_new(rootJ, "oversampleFactor", json_integer(oversampleFactor.load(std::memory_order_relaxed)));
+        json_object_set_new(rootJ, "oversampleQuality", json_integer(oversampleQuality.load(std::memory_order_relaxed)));
         json_object_set_new(rootJ, "highCutEnabled", json_boolean(highCutEnabled.load(std::memory_order_relaxed)));
         json_object_set_new(rootJ, "driftAmount", json_real(driftAmount.load(std::memory_order_relaxed)));
         json_object_set_new(rootJ, "oscopeTheme", json_integer(oscilloscopeTheme.load(std::memory_order_relaxed)));
+        json_object_set_new(rootJ, "simdOscillators", json_boolean(simdOscillators.load(std::memory_order_relaxed)));
+        mathSetting.dataToJson(rootJ);
         return rootJ;
     }
 
@@ -400,6 +402,10 @@ struct ClairaudientModule : Module, IOscilloscopeSource {
                 pendingFilterReset.store(true, std::memory_order_relaxed);
         }
 
+        json_t* oversampleQualityJ = json_object_get(rootJ, "oversampleQuality");
+        if (oversampleQualityJ)
+            oversampleQuality.store(clamp((int)json_integer_value(oversampleQualityJ), 0, shapetaker::dsp::Oversampler::QUALITY_COUNT - 1), std::memory_order_relaxed);
+
         json_t* highCutJ = json_object_get(rootJ, "highCutEnabled");
         if (highCutJ) {
             bool newHighCut = json_boolean_value(highCutJ);
@@ -416,6 +422,12 @@ struct ClairaudientModule : Module, IOscilloscopeSource {
         if (oscopeThemeJ)
             oscilloscopeTheme.store(clamp((int)json_integer_value(oscopeThemeJ), 0, shapetaker::ui::ThemeManager::DisplayTheme::THEME_COUNT - 1), std::memory_order_relaxed);
 
+        json_t* simdOscJ = json_object_get(rootJ, "simdOscillators");
+        if (simdOscJ)
+            simdOscillators.store(json_boolean_value(simdOscJ), std::memory_order_relaxed);
+
+        mathSetting.dataFromJson(rootJ);
+
         // Update parameter snapping after loading settings
         updateParameterSnapping();
     }
@@ -433,11 +445,15 @@ struct ClairaudientModule : Module, IOscilloscopeSource {
             MAX_POLY_VOICES);
 
         // Apply the configured oversampling factor (1×, 2×, 4×, or 8×, default 4×)
-        const int oversample = std::max(1, oversampleFactor.load(std::memory_order_relaxed));
+        const int oversample = shapetaker::dsp::Oversampler::sanitizeFactor(oversampleFactor.load(std::memory_order_relaxed));
+        const int oversampleQualityLocal = oversampleQuality.load(std::memory_order_relaxed);
         const bool highCutEnabledLocal = highCutEnabled.load(std::memory_order_relaxed);
         const int crossfadeModeLocal = crossfadeMode.load(std::memory_order_relaxed);
         const int waveformModeLocal = waveformMode.load(std::memory_order_relaxed);
         const float driftAmountLocal = driftAmount.load(std::memory_order_relaxed);
+        const bool simdOscLocal = simdOscillators.load(std::memory_order_relaxed);
+        shapetaker::dsp::MathMode math;
+        mathSetting.apply(math);
         float oversampleRate = args.sampleRate * oversample;
 
         // Pre-calculate constants that are the same for all voices and oversample iterations
@@ -448,12 +464,11 @@ struct ClairaudientModule : Module, IOscilloscopeSource {
         }
         float shapedNoise = cachedShapedNoise;
         float invOversampleRate = 1.f / oversampleRate; // Pre-compute reciprocal for faster multiplication
-        bool doAntiAlias = oversample > 1;
 
-        if (args.sampleRate != cachedSampleRate || oversample != cachedOversample || highCutEnabledLocal != cachedHighCutEnabled) {
-            updateFilterCoefficients(args.sampleRate, oversample, highCutEnabledLocal);
+        if (args.sampleRate != cachedSampleRate || oversample != cachedOversample
+            || oversampleQualityLocal != cachedOversampleQuality || highCutEnabledLocal != cachedHighCutEnabled) {
+            updateFilterCoefficients(args.sampleRate, oversample, oversampleQualityLocal, highCutEnabledLocal);
         }
-        float antiAliasAlpha = cachedAntiAliasAlpha;
         float highCutAlpha = cachedHighCutAlpha;
 
         // Parameter decimation: only read parameters every N samples for performance
@@ -498,15 +513,16 @@ struct ClairaudientModule : Module, IOscilloscopeSource {
 
         // Pre-calculate crossfade coefficients for the common (no CV) case
         float xfadeClampedGlobal = clamp(cachedXfade, 0.f, 1.f);
-        float xfadeAngleGlobal = xfadeClampedGlobal * (float)M_PI_2;
-        float xfadeCosGlobal = std::cos(xfadeAngleGlobal);
-        float xfadeSinGlobal = std::sin(xfadeAngleGlobal);
-        float widthBlendGlobal = std::sin(xfadeClampedGlobal * (float)M_PI);
+        // Quarter-cycle equal-power fade, phases in cycles
+        float xfadePhaseGlobal = xfadeClampedGlobal * 0.25f;
+        float xfadeCosGlobal = math.cos2pi(xfadePhaseGlobal);
+        float xfadeSinGlobal = math.sin2pi(xfadePhaseGlobal);
+        float widthBlendGlobal = math.sin2pi(xfadeClampedGlobal * 0.5f);
 
         // Process each voice
         for (int ch = 0; ch < channels; ch++) {
-            float finalLeft = 0.f;
-            float finalRight = 0.f;
+            float oversampledLeft[shapetaker::dsp::Oversampler::MAX_FACTOR];
+            float oversampledRight[shapetaker::dsp::Oversampler::MAX_FACTOR];
 
             // --- Pre-calculate parameters for this voice ---
             // Get V/Oct inputs with fallback logic (use cached connection state)
@@ -584,12 +600,12 @@ struct ClairaudientModule : Module, IOscilloscopeSource {
             float deltaPhase2B = freq2B * invOversampleRate;
 
             // Pre-calculate crossfade coefficients outside loop to avoid repeated sin/cos
-            float xfadeAngle = xfadeClamped * (float)M_PI_2;
-            float xfadeCos = cachedXfadeCVConnected ? std::cos(xfadeAngle) : xfadeCosGlobal;
-            float xfadeSin = cachedXfadeCVConnected ? std::sin(xfadeAngle) : xfadeSinGlobal;
+            float xfadePhase = xfadeClamped * 0.25f;
+            float xfadeCos = cachedXfadeCVConnected ? math.cos2pi(xfadePhase) : xfadeCosGlobal;
+            float xfadeSin = cachedXfadeCVConnected ? math.sin2pi(xfadePhase) : xfadeSinGlobal;
             bool stereoSwap = (crossfadeModeLocal == CROSSFADE_STEREO_SWAP);
             // Width accent for swap: crossfeed with opposite polarity peaks at mid fade
-            float widthBlend = cachedXfadeCVConnected ? std::sin(xfadeClamped * (float)M_PI) : widthBlendGlobal;
+            float widthBlend = cachedXfadeCVConnected ? math.sin2pi(xfadeClamped * 0.5f) : widthBlendGlobal;
             float widthGain = STEREO_SWAP_WIDTH_GAIN * widthBlend;
 
             const float noiseScale = PHASE_NOISE_SCALE * shapedNoise;
@@ -601,6 +617,15 @@ struct ClairaudientModule : Module, IOscilloscopeSource {
                 return shapetaker::dsp::OscillatorHelper::organicSigmoidSaw(phase, shape, freq, oversampleRate);
             };
 
+            // Lane layout for the vector path: {1A, 1B, 2A, 2B}
+            const simd::float_4 shape4(shape1, shape1, shape2, shape2);
+            const simd::float_4 freq4(freq1A, freq1B, freq2A, freq2B);
+            auto computeOsc4 = [&](simd::float_4 phase4) -> simd::float_4 {
+                if (waveformModeLocal == WAVEFORM_PWM)
+                    return shapetaker::dsp::OscillatorHelper::pwmWithPolyBLEP(phase4, shape4, freq4, oversampleRate);
+                return shapetaker::dsp::OscillatorHelper::organicSigmoidSaw(phase4, shape4, freq4, oversampleRate);
+            };
+
             for (int os = 0; os < oversample; os++) {
 
                 // Add subtle phase noise for organic character (scaled by shaped user amount)
@@ -637,10 +662,19 @@ struct ClairaudientModule : Module, IOscilloscopeSource {
                     phaseDir2B[ch] = 1.f;
                 }
 
-                float osc1A = computeOsc(phase1A[ch], shape1, freq1A);
-                float osc1B = computeOsc(phase1B[ch], shape1, freq1B);
-                float osc2A = computeOsc(phase2A[ch], shape2, freq2A);
-                float osc2B = computeOsc(phase2B[ch], shape2, freq2B);
+                float osc1A, osc1B, osc2A, osc2B;
+                if (simdOscLocal) {
+                    simd::float_4 osc4 = computeOsc4(simd::float_4(phase1A[ch], phase1B[ch], phase2A[ch], phase2B[ch]));
+                    osc1A = osc4[0];
+                    osc1B = osc4[1];
+                    osc2A = osc4[2];
+                    osc2B = osc4[3];
+                } else {
+                    osc1A = computeOsc(phase1A[ch], shape1, freq1A);
+                    osc1B = computeOsc(phase1B[ch], shape1, freq1B);
+                    osc2A = computeOsc(phase2A[ch], shape2, freq2A);
+                    osc2B = computeOsc(phase2B[ch], shape2, freq2B);
+                }
 
                 float leftOutput;
                 float rightOutput;
@@ -659,25 +693,16 @@ struct ClairaudientModule : Module, IOscilloscopeSource {
                     rightOutput = baseRight + widthGain * rightCross;
                 }
 
-                // Apply anti-aliasing filter to each channel separately for true stereo
-                float filteredLeft = doAntiAlias
-                    ? antiAliasFilterLeftStage2[ch].processWithAlpha(
-                        antiAliasFilterLeft[ch].processWithAlpha(leftOutput, antiAliasAlpha),
-                        antiAliasAlpha)
-                    : leftOutput;
-                float filteredRight = doAntiAlias
-                    ? antiAliasFilterRightStage2[ch].processWithAlpha(
-                        antiAliasFilterRight[ch].processWithAlpha(rightOutput, antiAliasAlpha),
-                        antiAliasAlpha)
-                    : rightOutput;
-
-                finalLeft  += filteredLeft;
-                finalRight += filteredRight;
+                oversampledLeft[os]  = leftOutput;
+                oversampledRight[os] = rightOutput;
             }
-            
-            // Average the oversampled result for this voice
-            float outL = std::tanh(finalLeft / oversample) * OUTPUT_GAIN;
-            float outR = std::tanh(finalRight / oversample) * OUTPUT_GAIN;
+
+            // Halfband decimation back to the engine rate, each channel separately for true stereo
+            float finalLeft  = decimatorLeft[ch].downsample(oversampledLeft);
+            float finalRight = decimatorRight[ch].downsample(oversampledRight);
+
+            float outL = math.tanh(finalLeft) * OUTPUT_GAIN;
+            float outR = math.tanh(finalRight) * OUTPUT_GAIN;
 
             // DC blocking (~10 Hz high-pass) removes offset from asymmetric waveshaping
             outL = shapetaker::dsp::AudioProcessor::processDCBlock(outL, dcLastInputL[ch], dcLastOutputL[ch]);
@@ -956,8 +981,25 @@ struct ClairaudientWidget : ShapetakerModuleWidget {
             addOversampleItem("2×", 2);
             addOversampleItem("4×", 4);
             addOversampleItem("8×", 8);
+
+            subMenu->addChild(new MenuSeparator);
+            auto addQualityItem = [&](const std::string& label, int quality) {
+                subMenu->addChild(createCheckMenuItem(label, "", [=] { return module->oversampleQuality.load(std::memory_order_relaxed) == quality; }, [=] {
+                    module->oversampleQuality.store(quality, std::memory_order_relaxed);
+                }));
+            };
+
+            addQualityItem("Eco Filter", shapetaker::dsp::Oversampler::QUALITY_ECO);
+            addQualityItem("Standard Filter", shapetaker::dsp::Oversampler::QUALITY_STANDARD);
+            addQualityItem("High Filter", shapetaker::dsp::Oversampler::QUALITY_HIGH);
+        }));
+
+        menu->addChild(createCheckMenuItem("Vectorized Oscillators", "", [=] { return module->simdOscillators.load(std::memory_order_relaxed); }, [=] {
+            module->simdOscillators.store(!module->simdOscillators.load(std::memory_order_relaxed), std::memory_order_relaxed);
         }));
 
+        menu->addChild(shapetaker::ui::createPreciseMathItem(&module->mathSetting));
+
         menu->addChild(new MenuSeparator);
         menu->addChild(createMenuLabel("Waveform Mode"));
 
@@ -0,0 +1,71 @@
+#pragma once
+#include <rack.hpp>
+#include <algorithm>
+
+using namespace rack;
+
+namespace shapetaker {
+namespace dsp {
+
+// ============================================================================
+// CONTROL-RATE SCHEDULING
+// ============================================================================
+
+/**
+ * Runs light, display and telemetry work every N audio samples instead of
+ * every sample. Call tick() once per process(); when it returns true, do the
+ * control-rate work and use getElapsed() as its time step so smoothing and
+ * ballistics keep the same time constants at any division.
+ *
+ *     if (lightTicker.tick(args.sampleTime)) {
+ *         lights[X].setBrightnessSmooth(level, lightTicker.getElapsed());
+ *     }
+ */
+class ControlRateTicker {
+public:
+    static constexpr int DEFAULT_DIVISION = 32;  // ~1.5 kHz at 48 kHz, well above the UI frame rate
+
+    explicit ControlRateTicker(int division = DEFAULT_DIVISION) {
+        setDivision(division);
+    }
+
+    void setDivision(int newDivision) {
+        division = std::max(1, newDivision);
+        counter = std::min(counter, division - 1);
+    }
+
+    int getDivision() const {
+        return division;
+    }
+
+    // Next tick() fires immediately
+    void reset() {
+        counter = division - 1;
+        accumulated = 0.f;
+        elapsed = 0.f;
+    }
+
+    bool tick(float sampleTime) {
+        accumulated += sampleTime;
+        if (++counter < division) {
+            return false;
+        }
+        counter = 0;
+        elapsed = accumulated;
+        accumulated = 0.f;
+        return true;
+    }
+
+    // Seconds covered by the most recent tick
+    float getElapsed() const {
+        return elapsed;
+    }
+
+private:
+    int division = DEFAULT_DIVISION;
+    int counter = DEFAULT_DIVISION - 1;
+    float accumulated = 0.f;
+    float elapsed = 0.f;
+};
+
+}} // namespace shapetaker::dsp
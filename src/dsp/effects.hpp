@@ -2,6 +2,8 @@
 #include <rack.hpp>
 #include <algorithm>
 #include <cmath>
+#include <cstdint>
+#include "fastmath.hpp"
 
 using namespace rack;
 
@@ -134,6 +136,9 @@ private:
     // Dither noise generator state for bit crush
     unsigned int ditherSeed = 1;
 
+    // Eco (fastmath) or precise (libm) transcendentals
+    MathMode math;
+
 public:
     enum Type {
         HARD_CLIP = 0,  // Aggressive limiting with harsh harmonics
@@ -157,6 +162,10 @@ public:
         dcBlockR = rack::math::clamp(1.0f - (2.0f * (float)M_PI * dcCutoffHz / sample_rate), 0.9f, 0.9999f);
     }
     
+    void setPreciseMath(bool precise) {
+        math.precise = precise;
+    }
+
     /**
      * Reset internal state (useful for feedback-based algorithms)
      */
@@ -368,7 +377,7 @@ private:
             // Add "edge" at clipping point (emphasizes transients)
             float overshoot = (abs_x - threshold) * 0.15f;
             overshoot = rack::math::clamp(overshoot, 0.0f, threshold * 0.2f);
-            clipped += copysignf(overshoot, x) * (1.0f - expf(-overshoot * 5.0f));
+            clipped += copysignf(overshoot, x) * (1.0f - math.exp(-overshoot * 5.0f));
         }
 
         // Add odd harmonics for more aggression (opposite of tube sat's even harmonics)
@@ -409,11 +418,11 @@ private:
         bits = rack::math::clamp(bits, 4.0f, 16.0f);
 
         // Add TPDF dithering before quantization (scaled to bit depth)
-        float ditherAmount = 1.0f / std::exp2f(bits);
+        float ditherAmount = 1.0f / math.exp2(bits);
         float dithered = input + dither() * ditherAmount * 0.5f;
 
         // Quantize to the reduced bit depth
-        float scale = std::exp2f(bits - 1.0f);
+        float scale = math.exp2(bits - 1.0f);
         float quantized = roundf(dithered * scale) / scale;
         quantized = rack::math::clamp(quantized, -1.0f, 1.0f);
 
@@ -454,7 +463,7 @@ private:
 
         // Stage 4: Nonlinear cross-modulated feedback
         float feedback = crushed * drive * 0.35f;
-        float modulation = sinf(prev_input * 3.14159f) * drive * 0.15f;
+        float modulation = math.sin2pi(prev_input * 0.5f) * drive * 0.15f;
         prev_input = crushed + (feedback * prev_input) + modulation;
 
         // Soft limiting to prevent runaway
@@ -470,7 +479,7 @@ private:
      */
     float ringMod(float input, float drive) {
         // Carrier frequency: exponential sweep from 2Hz (tremolo) to 2kHz (metallic)
-        float carrier_freq = 2.0f * std::exp2f(drive * 10.0f); // 2Hz -> ~2048Hz
+        float carrier_freq = 2.0f * math.exp2(drive * 10.0f); // 2Hz -> ~2048Hz
 
         // Update phase
         phase += 2.0f * M_PI * carrier_freq / sample_rate;
@@ -479,7 +488,7 @@ private:
         }
 
         // Generate carrier wave that morphs with drive
-        float sine = sinf(phase);
+        float sine = math.sin2pi(phase * (0.5f / static_cast<float>(M_PI)));
         float triangle = 2.0f * fabsf(2.0f * (phase / (2.0f * static_cast<float>(M_PI)) - 0.5f)) - 1.0f;
         float square = (phase < static_cast<float>(M_PI)) ? 1.0f : -1.0f;
 
@@ -528,4 +537,321 @@ private:
     }
 };
 
+/**
+ * Four DistortionEngine lanes in a simd::float_4 (Chiaroscuro packs the L/R
+ * pair of two voices, or four voices when both sides carry the same signal).
+ * Same algorithms and constants as DistortionEngine, except:
+ * - process() works on a block and takes the type as a continuous position.
+ *   The algorithm is chosen once per block, and across TYPE_FADE_WIDTH
+ *   around each midpoint the two neighbouring types are crossfaded instead
+ *   of switched.
+ * - The ring-mod carrier and the bit-crush hold counter are shared by the
+ *   lanes (they all see the same drive). DESTROY keeps its own crush state so
+ *   it can run next to BIT_CRUSH during a fade.
+ */
+class DistortionEngine4 {
+public:
+    using float_4 = simd::float_4;
+
+    static constexpr int TYPE_COUNT = 6;
+    static constexpr float TYPE_FADE_WIDTH = 0.2f;
+
+    void setSampleRate(float sr) {
+        sample_rate = sr;
+        crush.counter = 0;
+        destroyCrush.counter = 0;
+        const float dcCutoffHz = 10.0f;
+        dcBlockR = rack::math::clamp(1.0f - (2.0f * (float)M_PI * dcCutoffHz / sample_rate), 0.9f, 0.9999f);
+    }
+
+    void setPreciseMath(bool precise) {
+        math.precise = precise;
+    }
+
+    void reset() {
+        carrierPhase = 0.f;
+        prev_input = 0.f;
+        crush = CrushState();
+        destroyCrush = CrushState();
+        dcBlocker_x1 = dcBlocker_y1 = 0.f;
+        preEmph_x1 = deEmph_y1 = 0.f;
+        for (int i = 0; i < 4; ++i) {
+            ditherSeed[i] = 1;
+        }
+    }
+
+    /**
+     * Process `frames` samples in place
+     * @param drive Distortion amount (0.0 - 1.0)
+     * @param typePosition Type as a position in [0, TYPE_COUNT - 1]
+     */
+    void process(float_4* buffer, int frames, float drive, float typePosition) {
+        drive = rack::math::clamp(drive, 0.0f, 1.0f);
+
+        if (drive < 0.001f) {
+            for (int i = 0; i < frames; ++i) {
+                prev_input *= 0.99f;
+                buffer[i] = dcBlock(buffer[i]);
+            }
+            return;
+        }
+
+        typePosition = rack::math::clamp(typePosition, 0.f, (float)(TYPE_COUNT - 1));
+        int typeA = std::min((int)typePosition, TYPE_COUNT - 1);
+        float fade = rack::math::clamp((typePosition - typeA - 0.5f) / TYPE_FADE_WIDTH + 0.5f, 0.f, 1.f);
+        int typeB = std::min(typeA + 1, TYPE_COUNT - 1);
+        if (fade >= 1.f) {
+            typeA = typeB;
+            fade = 0.f;
+        }
+
+        for (int start = 0; start < frames; start += MAX_BLOCK) {
+            int count = frames - start < MAX_BLOCK ? frames - start : MAX_BLOCK;
+            float_4* x = buffer + start;
+
+            for (int i = 0; i < count; ++i) {
+                x[i] = preEmphasis(dcBlock(x[i]), drive);
+            }
+
+            if (fade > 0.f) {
+                float_4 other[MAX_BLOCK];
+                for (int i = 0; i < count; ++i) {
+                    other[i] = x[i];
+                }
+                processType(typeA, x, count, drive);
+                processType(typeB, other, count, drive);
+                for (int i = 0; i < count; ++i) {
+                    x[i] += (other[i] - x[i]) * fade;
+                }
+            } else {
+                processType(typeA, x, count, drive);
+            }
+
+            for (int i = 0; i < count; ++i) {
+                x[i] = deEmphasis(x[i], drive);
+            }
+        }
+    }
+
+private:
+    static constexpr int MAX_BLOCK = 8;
+
+    struct CrushState {
+        int counter = 0;
+        int hold = 1;
+        float_4 sample = 0.f;
+    };
+
+    float sample_rate = 44100.0f;
+    float carrierPhase = 0.f;      // ring-mod carrier, in cycles
+    float_4 prev_input = 0.f;      // DESTROY feedback
+    CrushState crush;
+    CrushState destroyCrush;
+    float_4 dcBlocker_x1 = 0.f;
+    float_4 dcBlocker_y1 = 0.f;
+    float_4 preEmph_x1 = 0.f;
+    float_4 deEmph_y1 = 0.f;
+    float dcBlockR = 0.99857f;
+    uint32_t ditherSeed[4] = {1, 1, 1, 1};
+    MathMode math;
+
+    // One switch per block; the loops inside each case are branch-free
+    void processType(int type, float_4* x, int count, float drive) {
+        switch (type) {
+            case DistortionEngine::HARD_CLIP:
+                for (int i = 0; i < count; ++i) {
+                    x[i] = hardClip(x[i], drive);
+                }
+                break;
+            case DistortionEngine::TUBE_SAT: {
+                float bias = drive * 0.5f;
+                float biasCurve = tubeCurve(bias);
+                for (int i = 0; i < count; ++i) {
+                    x[i] = tubeSat(x[i], drive, bias, biasCurve);
+                }
+                break;
+            }
+            case DistortionEngine::WAVE_FOLD:
+                for (int i = 0; i < count; ++i) {
+                    x[i] = waveFold(x[i], drive);
+                }
+                break;
+            case DistortionEngine::BIT_CRUSH:
+                bitCrush(x, count, drive, crush);
+                break;
+            case DistortionEngine::DESTROY:
+                for (int i = 0; i < count; ++i) {
+                    x[i] = destroy(x[i], drive);
+                }
+                break;
+            case DistortionEngine::RING_MOD:
+                ringMod(x, count, drive);
+                break;
+            default:
+                break;
+        }
+    }
+
+    float_4 dcBlock(float_4 input) {
+        float_4 output = input - dcBlocker_x1 + dcBlockR * dcBlocker_y1;
+        dcBlocker_x1 = input;
+        dcBlocker_y1 = output;
+        return output;
+    }
+
+    float_4 preEmphasis(float_4 input, float drive) {
+        const float a = 0.85f;
+        float boost = 1.0f + (drive * 0.3f);
+        float_4 highpass = input - preEmph_x1;
+        preEmph_x1 = input;
+        return input + highpass * (boost * (1.0f - a));
+    }
+
+    float_4 deEmphasis(float_4 input, float drive) {
+        const float a = 0.85f;
+        float cut = 1.0f + (drive * 0.3f);
+        float_4 highpass = input - deEmph_y1;
+        deEmph_y1 = input;
+        return input - highpass * (cut * (1.0f - a));
+    }
+
+    float_4 dither() {
+        float_4 noise;
+        for (int lane = 0; lane < 4; ++lane) {
+            uint32_t& seed = ditherSeed[lane];
+            seed = seed * 1664525u + 1013904223u;
+            float r1 = (float)(seed & 0x7FFFFFFF) / 2147483648.0f;
+            seed = seed * 1664525u + 1013904223u;
+            float r2 = (float)(seed & 0x7FFFFFFF) / 2147483648.0f;
+            noise[lane] = (r1 + r2 - 1.0f) * 0.5f;
+        }
+        return noise;
+    }
+
+    static float tubeCurve(float x) {
+        return x > 0.0f ? x / (1.0f + x * x * 0.5f) : x / (1.0f + x * x * 0.7f);
+    }
+
+    // Softer positive side, harder negative side (grid current)
+    static float_4 tubeCurve(float_4 x) {
+        return x / (1.0f + x * x * simd::ifelse(x > 0.f, 0.5f, 0.7f));
+    }
+
+    static float_4 smoothFold(float_4 x) {
+        // Every pass folds each outlying lane back by up to 2; the cap only
+        // guards against non-finite input
+        for (int pass = 0; pass < 32; ++pass) {
+            float_4 high = x > 1.0f;
+            float_4 low = x < -1.0f;
+            if (simd::movemask(high | low) == 0) {
+                break;
+            }
+            float_4 excessHigh = x - 1.0f;
+            float_4 foldedHigh = 1.0f - excessHigh * (3.0f - 2.0f * simd::clamp(excessHigh, 0.0f, 1.0f));
+            foldedHigh = simd::ifelse(excessHigh > 1.0f, excessHigh - 2.0f, foldedHigh);
+            float_4 excessLow = -1.0f - x;
+            float_4 foldedLow = -1.0f + excessLow * (3.0f - 2.0f * simd::clamp(excessLow, 0.0f, 1.0f));
+            foldedLow = simd::ifelse(excessLow > 1.0f, 2.0f - excessLow, foldedLow);
+            x = simd::ifelse(high, foldedHigh, simd::ifelse(low, foldedLow, x));
+        }
+        return x;
+    }
+
+    float_4 hardClip(float_4 input, float drive) {
+        float gain = (1.0f + drive * 0.4f) * (1.0f + drive * 25.0f);
+        float threshold = rack::math::crossfade(1.0f, 0.12f, drive);
+        float_4 x = input * gain;
+        float_4 abs_x = simd::fabs(x);
+        float_4 sign = simd::ifelse(x < 0.f, -1.0f, 1.0f);
+
+        float_4 soft = x + x * x * x * 0.1f;
+        float_4 overshoot = simd::clamp((abs_x - threshold) * 0.15f, 0.0f, threshold * 0.2f);
+        float_4 hard = sign * (threshold + overshoot * (1.0f - math.exp(-overshoot * 5.0f)));
+        float_4 clipped = simd::ifelse(abs_x <= threshold, soft, hard);
+
+        float_4 enhanced = clipped + clipped * clipped * clipped * (drive * 0.15f);
+        return simd::clamp(enhanced * 3.5f, -1.0f, 1.0f);
+    }
+
+    // Per-lane drive: DESTROY feeds lane-dependent fold amounts
+    static float_4 waveFold(float_4 input, float_4 drive) {
+        float_4 x = smoothFold(input * (1.0f + drive * 6.0f));
+        float_4 extraFold = simd::fmax(drive - 0.5f, 0.f) * 2.0f;
+        if (simd::movemask(extraFold > 0.f)) {
+            x = x + extraFold * smoothFold(x * 2.0f) * 0.3f;
+        }
+        return simd::clamp(x * 0.7f, -1.0f, 1.0f);
+    }
+
+    void bitCrush(float_4* x, int count, float drive, CrushState& state) {
+        float bits = rack::math::clamp(rack::math::crossfade(16.0f, 4.0f, drive), 4.0f, 16.0f);
+        float ditherAmount = 0.5f / math.exp2(bits);
+        float scale = math.exp2(bits - 1.0f);
+        float invScale = 1.0f / scale;
+
+        int desiredHold = std::max(1 + (int)std::round(drive * drive * 63.0f), 1);
+        if (desiredHold != state.hold) {
+            state.hold = desiredHold;
+            state.counter = std::min(state.counter, state.hold);
+        }
+
+        for (int i = 0; i < count; ++i) {
+            float_4 dithered = x[i] + dither() * ditherAmount;
+            float_4 quantized = simd::clamp(simd::round(dithered * scale) * invScale, -1.0f, 1.0f);
+            if (state.counter <= 0) {
+                state.counter = state.hold;
+                state.sample = quantized;
+            } else {
+                state.counter--;
+            }
+            x[i] = simd::clamp(state.sample * 1.1f, -1.0f, 1.0f);
+        }
+    }
+
+    float_4 destroy(float_4 input, float drive) {
+        float_4 folded = waveFold(input, drive * 0.7f + simd::fabs(prev_input) * 0.2f);
+        float_4 clipped = hardClip(folded, drive * 0.6f);
+        float_4 crushed = clipped;
+        bitCrush(&crushed, 1, drive * 0.8f, destroyCrush);
+
+        float_4 feedback = crushed * (drive * 0.35f);
+        float_4 modulation = math.sin2pi(prev_input * 0.5f) * (drive * 0.15f);
+        prev_input = crushed + feedback * prev_input + modulation;
+
+        prev_input = simd::clamp(tubeCurve(prev_input * 0.7f), -2.0f, 2.0f);
+        return simd::clamp(prev_input * 0.7f, -1.0f, 1.0f);
+    }
+
+    // Carrier morphs sine -> triangle -> square with drive
+    void ringMod(float_4* x, int count, float drive) {
+        float carrierInc = 2.0f * math.exp2(drive * 10.0f) / sample_rate;
+        for (int i = 0; i < count; ++i) {
+            carrierPhase += carrierInc;
+            if (carrierPhase >= 1.f) {
+                carrierPhase -= 1.f;
+            }
+            float sine = math.sin2pi(carrierPhase);
+            float triangle = 2.0f * std::fabs(2.0f * (carrierPhase - 0.5f)) - 1.0f;
+            float square = carrierPhase < 0.5f ? 1.0f : -1.0f;
+            float carrier = drive < 0.5f
+                ? rack::math::crossfade(sine, triangle, drive * 2.0f)
+                : rack::math::crossfade(triangle, square, (drive - 0.5f) * 2.0f);
+
+            float_4 modulated = x[i] * (carrier * (1.0f + drive));
+            x[i] = simd::clamp(tubeCurve(modulated * 0.8f) * 1.6f, -1.0f, 1.0f);
+        }
+    }
+
+    static float_4 tubeSat(float_4 input, float drive, float bias, float biasCurve) {
+        float_4 x = input * (1.0f + drive * 9.0f);
+        float_4 triode = tubeCurve(x);
+        float_4 biased = tubeCurve(triode + bias) - biasCurve;
+        float_4 transformer = biased / (1.0f + simd::fabs(biased) * 0.3f);
+        float sag = drive * drive * 0.15f;
+        float_4 bloom = transformer * (1.0f - sag * simd::fabs(transformer));
+        float_4 output = triode + (bloom - triode) * (drive * 0.7f);
+        return simd::clamp(output * 1.15f, -1.0f, 1.0f);
+    }
+};
+
 }} // namespace shapetaker::dsp
@@ -0,0 +1,249 @@
+#pragma once
+#include <rack.hpp>
+#include <atomic>
+#include <cmath>
+#include <cstdint>
+#include <cstring>
+#include <limits>
+
+using namespace rack;
+
+namespace shapetaker {
+namespace dsp {
+
+// ============================================================================
+// FAST TRANSCENDENTALS
+// ============================================================================
+//
+// Scalar and simd::float_4 approximations for the functions hot loops call
+// per sample. Both versions use the same polynomials, so results agree to
+// the last bit or two. Error bounds below were measured against libm in
+// double precision over the stated domain (`make fastmath-check`):
+//
+//   exp2(x)         x in [-126, 127]        relative error  < 3e-7
+//   log2(x)         x > 0, normal floats    error < 1.5e-7 * max(1, |log2 x|)
+//   pow(x, y)       x >= 0                  relative error  < 3e-7 * (1 + |y log2 x|)
+//   exp(x)          x in [-87, 88]          relative error  < 3e-7 * (1 + |x|)
+//   tanh(x)         all finite x            absolute error  < 2e-7
+//   sin2pi(p)       |p| < 2^16 cycles       absolute error  < 2.5e-7
+//   cos2pi(p)       |p| < 2^16 cycles       absolute error  < 2.5e-7
+//
+// sin2pi/cos2pi take a phase in cycles (1.0 = 2 pi), the form oscillators and
+// LFOs already keep. pow(0, y) returns 0 and negative bases are treated as 0.
+
+namespace fastmath {
+
+constexpr float LOG2_E = 1.44269504f;
+constexpr float TWO_PI = 6.28318531f;
+
+// 2^f for f in [-0.5, 0.5]: Taylor series of e^(f ln 2), remainder < 1.3e-7
+template <typename T>
+inline T exp2Fraction(T f) {
+    const float c1 = 0.693147181f;
+    const float c2 = 0.240226507f;
+    const float c3 = 0.0555041087f;
+    const float c4 = 0.00961812911f;
+    const float c5 = 0.00133335581f;
+    const float c6 = 0.000154035304f;
+    return 1.f + f * (c1 + f * (c2 + f * (c3 + f * (c4 + f * (c5 + f * c6)))));
+}
+
+// log2(m) for m in [sqrt(1/2), sqrt(2)]: atanh series in u = (m - 1) / (m + 1)
+template <typename T>
+inline T log2Mantissa(T m) {
+    const float k = 2.f * LOG2_E;
+    T u = (m - 1.f) / (m + 1.f);
+    T u2 = u * u;
+    return k * u * (1.f + u2 * (1.f / 3.f + u2 * (1.f / 5.f + u2 * (1.f / 7.f + u2 * (1.f / 9.f)))));
+}
+
+// sin(theta) for theta in [-pi/2, pi/2]: Taylor series to theta^11
+template <typename T>
+inline T sinQuadrant(T theta) {
+    T t2 = theta * theta;
+    return theta * (1.f + t2 * (-1.f / 6.f + t2 * (1.f / 120.f + t2 * (-1.f / 5040.f +
+           t2 * (1.f / 362880.f + t2 * (-1.f / 39916800.f))))));
+}
+
+// ---- Scalar ----
+
+inline float exp2(float x) {
+    x = rack::math::clamp(x, -126.f, 127.f);
+    float whole = std::round(x);
+    float scale;
+    uint32_t bits = (uint32_t)((int32_t)whole + 127) << 23;
+    std::memcpy(&scale, &bits, sizeof(scale));
+    return scale * exp2Fraction(x - whole);
+}
+
+inline float log2(float x) {
+    if (!(x > 0.f)) {
+        return -std::numeric_limits<float>::infinity();
+    }
+    uint32_t bits;
+    std::memcpy(&bits, &x, sizeof(bits));
+    int32_t exponent = (int32_t)(bits >> 23) - 127;
+    // Mantissa as [1, 2), then folded to [sqrt(1/2), sqrt(2)]
+    bits = (bits & 0x007fffffu) | 0x3f800000u;
+    float m;
+    std::memcpy(&m, &bits, sizeof(m));
+    if (m > 1.41421356f) {
+        m *= 0.5f;
+        exponent++;
+    }
+    return (float)exponent + log2Mantissa(m);
+}
+
+inline float exp(float x) {
+    return exp2(x * LOG2_E);
+}
+
+inline float pow(float x, float y) {
+    if (!(x > 0.f)) {
+        return 0.f;
+    }
+    return exp2(y * log2(x));
+}
+
+inline float tanh(float x) {
+    float e = exp2(-2.f * LOG2_E * std::fabs(x));
+    float t = (1.f - e) / (1.f + e);
+    return x < 0.f ? -t : t;
+}
+
+inline float sin2pi(float phase) {
+    float x = phase - std::round(phase);
+    // Fold [-1/2, 1/2] onto [-1/4, 1/4] around the peaks
+    if (x > 0.25f) {
+        x = 0.5f - x;
+    } else if (x < -0.25f) {
+        x = -0.5f - x;
+    }
+    return sinQuadrant(x * TWO_PI);
+}
+
+// cos(2 pi x) = sin(2 pi (1/4 - |x|)), which needs no fold
+inline float cos2pi(float phase) {
+    float x = phase - std::round(phase);
+    return sinQuadrant((0.25f - std::fabs(x)) * TWO_PI);
+}
+
+// ---- simd::float_4 ----
+
+inline simd::float_4 exp2(simd::float_4 x) {
+    x = simd::clamp(x, -126.f, 127.f);
+    simd::float_4 whole = simd::round(x);
+    simd::int32_4 bits = (simd::int32_4(whole) + 127) << 23;
+    return simd::float_4::cast(bits) * exp2Fraction(x - whole);
+}
+
+inline simd::float_4 log2(simd::float_4 x) {
+    simd::int32_4 bits = simd::int32_4::cast(x);
+    simd::float_4 exponent = simd::float_4((bits >> 23) - 127);
+    simd::float_4 m = simd::float_4::cast((bits & 0x007fffff) | 0x3f800000);
+    simd::float_4 high = m > 1.41421356f;
+    m = simd::ifelse(high, m * 0.5f, m);
+    exponent = simd::ifelse(high, exponent + 1.f, exponent);
+    simd::float_4 result = exponent + log2Mantissa(m);
+    return simd::ifelse(x > 0.f, result, -std::numeric_limits<float>::infinity());
+}
+
+inline simd::float_4 exp(simd::float_4 x) {
+    return exp2(x * LOG2_E);
+}
+
+inline simd::float_4 pow(simd::float_4 x, simd::float_4 y) {
+    return simd::ifelse(x > 0.f, exp2(y * log2(simd::fmax(x, 1e-37f))), 0.f);
+}
+
+inline simd::float_4 tanh(simd::float_4 x) {
+    simd::float_4 e = exp2(-2.f * LOG2_E * simd::fabs(x));
+    simd::float_4 t = (1.f - e) / (1.f + e);
+    return simd::ifelse(x < 0.f, -t, t);
+}
+
+inline simd::float_4 sin2pi(simd::float_4 phase) {
+    simd::float_4 x = phase - simd::round(phase);
+    x = simd::ifelse(x > 0.25f, 0.5f - x, simd::ifelse(x < -0.25f, -0.5f - x, x));
+    return sinQuadrant(x * TWO_PI);
+}
+
+inline simd::float_4 cos2pi(simd::float_4 phase) {
+    simd::float_4 x = phase - simd::round(phase);
+    return sinQuadrant((0.25f - simd::fabs(x)) * TWO_PI);
+}
+
+} // namespace fastmath
+
+/**
+ * Eco/precise switch for the functions above. Eco uses the fastmath
+ * approximations; precise calls libm (scalar) or Rack's simd wrappers of it.
+ * DSP code holds one of these by value; modules fill it from their
+ * MathModeSetting at the top of process().
+ */
+struct MathMode {
+    bool precise = false;
+
+    float exp2(float x) const { return precise ? std::exp2(x) : fastmath::exp2(x); }
+    float exp(float x) const { return precise ? std::exp(x) : fastmath::exp(x); }
+    float log2(float x) const { return precise ? std::log2(x) : fastmath::log2(x); }
+    float pow(float x, float y) const { return precise ? std::pow(x, y) : fastmath::pow(x, y); }
+    float tanh(float x) const { return precise ? std::tanh(x) : fastmath::tanh(x); }
+    float sin2pi(float phase) const {
+        return precise ? std::sin(fastmath::TWO_PI * phase) : fastmath::sin2pi(phase);
+    }
+    float cos2pi(float phase) const {
+        return precise ? std::cos(fastmath::TWO_PI * phase) : fastmath::cos2pi(phase);
+    }
+
+    simd::float_4 exp2(simd::float_4 x) const { return precise ? simd::pow(2.f, x) : fastmath::exp2(x); }
+    simd::float_4 exp(simd::float_4 x) const { return precise ? simd::exp(x) : fastmath::exp(x); }
+    simd::float_4 tanh(simd::float_4 x) const {
+        if (!precise) {
+            return fastmath::tanh(x);
+        }
+        simd::float_4 e = simd::exp(2.f * simd::clamp(x, -9.f, 9.f));
+        return (e - 1.f) / (e + 1.f);
+    }
+    simd::float_4 sin2pi(simd::float_4 phase) const {
+        return precise ? simd::sin(fastmath::TWO_PI * phase) : fastmath::sin2pi(phase);
+    }
+    simd::float_4 cos2pi(simd::float_4 phase) const {
+        return precise ? simd::cos(fastmath::TWO_PI * phase) : fastmath::cos2pi(phase);
+    }
+};
+
+/**
+ * A module's eco/precise choice. The context menu (ui::createPreciseMathItem)
+ * writes it on the UI thread and process() copies it into the MathMode it
+ * runs with, so the two threads only share this atomic. Persisted as the
+ * "preciseMath" JSON key.
+ */
+struct MathModeSetting {
+    std::atomic<bool> precise{false};
+
+    bool isPrecise() const {
+        return precise.load(std::memory_order_relaxed);
+    }
+
+    void setPrecise(bool value) {
+        precise.store(value, std::memory_order_relaxed);
+    }
+
+    void apply(MathMode& math) const {
+        math.precise = isPrecise();
+    }
+
+    void dataToJson(json_t* rootJ) const {
+        json_object_set_new(rootJ, "preciseMath", json_boolean(isPrecise()));
+    }
+
+    void dataFromJson(json_t* rootJ) {
+        json_t* preciseJ = json_object_get(rootJ, "preciseMath");
+        if (preciseJ) {
+            setPrecise(json_boolean_value(preciseJ));
+        }
+    }
+};
+
+}} // namespace shapetaker::dsp
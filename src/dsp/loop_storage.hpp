@@ -0,0 +1,296 @@
+#pragma once
+#include <rack.hpp>
+#include <algorithm>
+#include <atomic>
+#include <cmath>
+#include <cstdint>
+#include <cstdlib>
+#include <cstring>
+#include <memory>
+#include <utility>
+#include <vector>
+
+using namespace rack;
+
+namespace shapetaker {
+namespace dsp {
+
+// ============================================================================
+// COMPACT SAMPLE FORMATS
+// ============================================================================
+
+enum LoopSampleFormat {
+    LOOP_FORMAT_FLOAT32 = 0,
+    LOOP_FORMAT_FLOAT16,
+    LOOP_FORMAT_INT16,
+    LOOP_FORMAT_COUNT
+};
+
+inline size_t loopSampleBytes(int format) {
+    return format == LOOP_FORMAT_FLOAT32 ? sizeof(float) : sizeof(uint16_t);
+}
+
+// IEEE 754 binary16, round to nearest even; overflow saturates to infinity
+inline uint16_t floatToHalf(float value) {
+    uint32_t bits;
+    std::memcpy(&bits, &value, sizeof(bits));
+    uint32_t sign = (bits >> 16) & 0x8000u;
+    uint32_t mag = bits & 0x7fffffffu;
+
+    if (mag >= 0x47800000u) {
+        // Too large for a half, infinity or NaN
+        return (uint16_t)(sign | (mag > 0x7f800000u ? 0x7e00u : 0x7c00u));
+    }
+    if (mag < 0x38800000u) {
+        // Half subnormal or zero
+        if (mag < 0x33000000u) {
+            return (uint16_t)sign;
+        }
+        uint32_t exponent = mag >> 23;
+        uint32_t mantissa = (mag & 0x7fffffu) | 0x800000u;
+        uint32_t shift = 126u - exponent;
+        uint32_t half = (mantissa + (1u << (shift - 1)) - 1u + ((mantissa >> shift) & 1u)) >> shift;
+        return (uint16_t)(sign | half);
+    }
+    // Rebias the exponent (127 -> 15); a rounding carry walks into the exponent
+    uint32_t rebased = mag - 0x38000000u;
+    return (uint16_t)(sign | ((rebased + 0xfffu + ((rebased >> 13) & 1u)) >> 13));
+}
+
+inline float halfToFloat(uint16_t half) {
+    uint32_t sign = (uint32_t)(half & 0x8000u) << 16;
+    uint32_t exponent = (half >> 10) & 0x1fu;
+    uint32_t mantissa = half & 0x3ffu;
+    uint32_t bits;
+    if (exponent == 0x1fu) {
+        bits = sign | 0x7f800000u | (mantissa << 13);
+    } else if (exponent == 0) {
+        // Subnormal: mantissa * 2^-24
+        float value = (float)mantissa * (1.f / 16777216.f);
+        return sign ? -value : value;
+    } else {
+        bits = sign | ((exponent + 112u) << 23) | (mantissa << 13);
+    }
+    float value;
+    std::memcpy(&value, &bits, sizeof(value));
+    return value;
+}
+
+// ============================================================================
+// PAGED LOOP STORAGE
+// ============================================================================
+
+/**
+ * Stereo loop memory committed in fixed pages as a recording grows, instead
+ * of a buffer sized for the longest possible loop per track.
+ *
+ * The audio thread records and plays through write()/read() and says how
+ * many frames from the start it needs backed (setRequiredFrames). A single
+ * non-audio thread calls service() to commit pages ahead of that and to free
+ * them after requestRelease(). Missing pages record nothing and play silence.
+ *
+ * Pages are dropped and freed in two steps: service() detaches them at
+ * the caller's audio epoch and frees them once the epoch has moved on, so
+ * the audio thread never touches freed memory. Samples can be kept as
+ * 32-bit float, 16-bit float or 16-bit integer (+/-INT16_FULL_SCALE volts);
+ * a format change takes effect the next time the storage is empty.
+ */
+class PagedLoopStorage {
+public:
+    static constexpr int PAGE_SHIFT = 12;
+    static constexpr size_t PAGE_FRAMES = size_t(1) << PAGE_SHIFT;  // 4096 stereo frames
+    static constexpr float INT16_FULL_SCALE = 12.f;                  // volts
+
+    PagedLoopStorage() = default;
+    PagedLoopStorage(const PagedLoopStorage&) = delete;
+    PagedLoopStorage& operator=(const PagedLoopStorage&) = delete;
+
+    ~PagedLoopStorage() {
+        for (size_t i = 0; i < pageCount; ++i) {
+            std::free(pages[i].load());
+        }
+        for (const RetiredPage& retired : retiredPages) {
+            std::free(retired.page);
+        }
+    }
+
+    // Sizes the page table (pointers only). Call once before the audio thread runs.
+    void setCapacity(size_t frames) {
+        pageCount = (frames + PAGE_FRAMES - 1) >> PAGE_SHIFT;
+        pages.reset(new std::atomic<void*>[pageCount]);
+        for (size_t i = 0; i < pageCount; ++i) {
+            pages[i].store(nullptr);
+        }
+    }
+
+    size_t getCapacity() const {
+        return pageCount << PAGE_SHIFT;
+    }
+
+    // ---- Audio thread ----
+
+    void setRequiredFrames(size_t frames) {
+        requiredFrames.store(std::min(frames, getCapacity()), std::memory_order_relaxed);
+    }
+
+    // True once frames [0, frames) are backed and writes will land
+    bool isReady(size_t frames) const {
+        if (releasePending.load(std::memory_order_acquire)) {
+            return false;
+        }
+        if (frames == 0) {
+            return true;
+        }
+        size_t last = (frames - 1) >> PAGE_SHIFT;
+        return last < pageCount && pages[last].load(std::memory_order_acquire) != nullptr;
+    }
+
+    void write(size_t frame, float left, float right) {
+        void* page = pageFor(frame);
+        if (!page) {
+            return;
+        }
+        size_t index = (frame & (PAGE_FRAMES - 1)) * 2;
+        switch (format.load(std::memory_order_relaxed)) {
+            case LOOP_FORMAT_FLOAT16: {
+                uint16_t* samples = static_cast<uint16_t*>(page);
+                samples[index] = floatToHalf(left);
+                samples[index + 1] = floatToHalf(right);
+                break;
+            }
+            case LOOP_FORMAT_INT16: {
+                int16_t* samples = static_cast<int16_t*>(page);
+                samples[index] = toInt16(left);
+                samples[index + 1] = toInt16(right);
+                break;
+            }
+            default: {
+                float* samples = static_cast<float*>(page);
+                samples[index] = left;
+                samples[index + 1] = right;
+                break;
+            }
+        }
+    }
+
+    void read(size_t frame, float& left, float& right) const {
+        const void* page = pageFor(frame);
+        if (!page) {
+            left = right = 0.f;
+            return;
+        }
+        size_t index = (frame & (PAGE_FRAMES - 1)) * 2;
+        switch (format.load(std::memory_order_relaxed)) {
+            case LOOP_FORMAT_FLOAT16: {
+                const uint16_t* samples = static_cast<const uint16_t*>(page);
+                left = halfToFloat(samples[index]);
+                right = halfToFloat(samples[index + 1]);
+                break;
+            }
+            case LOOP_FORMAT_INT16: {
+                const int16_t* samples = static_cast<const int16_t*>(page);
+                left = samples[index] * (INT16_FULL_SCALE / 32767.f);
+                right = samples[index + 1] * (INT16_FULL_SCALE / 32767.f);
+                break;
+            }
+            default: {
+                const float* samples = static_cast<const float*>(page);
+                left = samples[index];
+                right = samples[index + 1];
+                break;
+            }
+        }
+    }
+
+    // Drops the recording. Until service() has detached the pages the storage
+    // reads silence, ignores writes and reports not ready.
+    void requestRelease() {
+        requiredFrames.store(0, std::memory_order_relaxed);
+        releasePending.store(true, std::memory_order_release);
+    }
+
+    // ---- Service thread ----
+
+    void setFormat(int newFormat) {
+        requestedFormat = rack::math::clamp(newFormat, 0, LOOP_FORMAT_COUNT - 1);
+    }
+
+    int getFormat() const {
+        return format.load(std::memory_order_relaxed);
+    }
+
+    // Commits, detaches and frees pages. `audioEpoch` must be bumped by the
+    // audio thread at the start of every process() call.
+    void service(uint64_t audioEpoch) {
+        if (releasePending.load(std::memory_order_acquire)) {
+            for (size_t i = 0; i < committedPages; ++i) {
+                retiredPages.push_back({pages[i].exchange(nullptr), audioEpoch});
+            }
+            committedPages = 0;
+            releasePending.store(false, std::memory_order_release);
+        }
+
+        // Safe to change the layout only while nothing is committed
+        if (committedPages == 0 && requestedFormat != format.load(std::memory_order_relaxed)) {
+            format.store(requestedFormat, std::memory_order_relaxed);
+        }
+
+        size_t required = requiredFrames.load(std::memory_order_relaxed);
+        size_t wantedPages = std::min(pageCount, (required + PAGE_FRAMES - 1) >> PAGE_SHIFT);
+        size_t pageBytes = PAGE_FRAMES * 2 * loopSampleBytes(format.load(std::memory_order_relaxed));
+        while (committedPages < wantedPages) {
+            // calloc: zeroed pages read back as silence in every format
+            void* page = std::calloc(1, pageBytes);
+            if (!page) {
+                break;
+            }
+            pages[committedPages].store(page, std::memory_order_release);
+            committedPages++;
+        }
+
+        retiredPages.erase(std::remove_if(retiredPages.begin(), retiredPages.end(),
+            [audioEpoch](const RetiredPage& retired) {
+                if (audioEpoch > retired.epoch) {
+                    std::free(retired.page);
+                    return true;
+                }
+                return false;
+            }), retiredPages.end());
+    }
+
+    size_t getCommittedBytes() const {
+        return committedPages * PAGE_FRAMES * 2 * loopSampleBytes(format.load(std::memory_order_relaxed));
+    }
+
+private:
+    struct RetiredPage {
+        void* page;
+        uint64_t epoch;
+    };
+
+    std::unique_ptr<std::atomic<void*>[]> pages;
+    size_t pageCount = 0;
+    std::atomic<size_t> requiredFrames{0};
+    std::atomic<bool> releasePending{false};
+    std::atomic<int> format{LOOP_FORMAT_FLOAT32};
+
+    // Service thread only
+    int requestedFormat = LOOP_FORMAT_FLOAT32;
+    size_t committedPages = 0;
+    std::vector<RetiredPage> retiredPages;
+
+    void* pageFor(size_t frame) const {
+        size_t pageIndex = frame >> PAGE_SHIFT;
+        if (pageIndex >= pageCount || releasePending.load(std::memory_order_relaxed)) {
+            return nullptr;
+        }
+        return pages[pageIndex].load(std::memory_order_acquire);
+    }
+
+    static int16_t toInt16(float value) {
+        float scaled = rack::math::clamp(value * (32767.f / INT16_FULL_SCALE), -32767.f, 32767.f);
+        return (int16_t)std::lround(scaled);
+    }
+};
+
+}} // namespace shapetaker::dsp
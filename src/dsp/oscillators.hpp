@@ -1,6 +1,7 @@
 #pragma once
 #include <rack.hpp>
 #include <cmath>
+#include "pow_table.hpp"
 
 using namespace rack;
 
@@ -98,7 +99,7 @@ public:
     static float organicSigmoidSaw(float phase, float shape, float freq, float sampleRate) {
         shape = softenShapeEdges(shape);
         // Emphasize the midpoint so modulation sweeps feel more dramatic
-        float emphasizedShape = 1.f - std::pow(1.f - shape, 1.6f);
+        float emphasizedShape = 1.f - PowTable::shared().lookup(1.f - shape, 1.6f);
 
         // Linear sawtooth baseline (softened to match historical output level)
         float linearSaw = 2.f * phase - 1.f;
@@ -161,6 +162,21 @@ public:
         return 0.f;
     }
 
+    // PolyBLAMP residual, the integral of polyBLEP(), for corners (slope changes)
+    // t: distance from the corner in samples, negative before it
+    // Returns the correction to add per unit slope change (per sample)
+    static float polyBLAMP(float t) {
+        if (t >= 0.f && t < 1.f) {
+            float u = 1.f - t;
+            return u * u * u * (1.f / 6.f);
+        }
+        if (t < 0.f && t > -1.f) {
+            float u = 1.f + t;
+            return u * u * u * (1.f / 6.f);
+        }
+        return 0.f;
+    }
+
     // Generate PWM (Pulse Width Modulation) waveform with polyBLEP anti-aliasing
     // phase: oscillator phase [0, 1)
     // pulseWidth: duty cycle [0, 1], clamped to [0.05, 0.95] to prevent DC offset
@@ -195,6 +211,80 @@ public:
     static inline float generatePWM(float phase, float pulseWidth, float freq, float sampleRate) {
         return pwmWithPolyBLEP(phase, pulseWidth, freq, sampleRate);
     }
+
+    // ========================================================================
+    // SIMD (float_4) VARIANTS
+    // ========================================================================
+    // Lane-parallel versions of the shapers above for engines that run four
+    // oscillators side by side. They mirror the scalar code step for step so
+    // the scalar versions remain the reference; differences come only from
+    // the vector transcendental approximations (~1e-6 absolute).
+
+    static simd::float_4 softenShapeEdges(simd::float_4 shape) {
+        const simd::float_4 knee = 0.02f;
+        auto ease = [&](simd::float_4 t) {
+            // t <= 0 collapses to the rail, matching the scalar early-outs
+            t = simd::fmax(t, 0.f);
+            return (-t * t * t + 2.f * t * t) * knee;
+        };
+        simd::float_4 tLow = simd::ifelse(shape < 0.f, (shape + knee) / knee, shape / knee);
+        simd::float_4 tHigh = simd::ifelse(shape > 1.f, (1.f + knee - shape) / knee, (1.f - shape) / knee);
+        simd::float_4 low = ease(tLow);
+        simd::float_4 high = 1.f - ease(tHigh);
+        return simd::ifelse(shape < knee, low, simd::ifelse(shape > 1.f - knee, high, shape));
+    }
+
+    // tanh via exp(2x); the argument is clamped where float tanh saturates anyway
+    static simd::float_4 simdTanh(simd::float_4 x) {
+        x = simd::clamp(x, -9.f, 9.f);
+        simd::float_4 e = simd::exp(2.f * x);
+        return (e - 1.f) / (e + 1.f);
+    }
+
+    static simd::float_4 organicSigmoidSaw(simd::float_4 phase, simd::float_4 shape, simd::float_4 freq, float sampleRate) {
+        const simd::float_4 twoPi = 2.f * (float)M_PI;
+        shape = softenShapeEdges(shape);
+        simd::float_4 emphasizedShape = 1.f - PowTable::shared().lookup(1.f - shape, 1.6f);
+
+        simd::float_4 linearSaw = 2.f * phase - 1.f;
+        simd::float_4 baseSaw = simdTanh(linearSaw * 1.02f) * 0.98f;
+
+        simd::float_4 range = 3.f + emphasizedShape * 10.f;
+        simd::float_4 sigmoidInput = (phase - 0.5f) * range * 2.f;
+        sigmoidInput += simd::sin(phase * twoPi * 3.f) * 0.03f * emphasizedShape;
+
+        simd::float_4 sigmoidOutput = simdTanh(sigmoidInput);
+
+        simd::float_4 blend = emphasizedShape * 1.25f + simd::sin(phase * twoPi) * 0.015f * emphasizedShape;
+        blend = simd::clamp(blend, 0.f, 1.f);
+
+        simd::float_4 result = linearSaw * (1.f - blend) + sigmoidOutput * blend;
+
+        simd::float_4 nyquist = sampleRate * 0.5f;
+        simd::float_4 air = simd::sin(phase * twoPi * 7.f) * 0.008f * emphasizedShape;
+        result += simd::ifelse(freq < nyquist * 0.35f, air, 0.f);
+
+        simd::float_4 shaped = simdTanh(result * 1.05f) * 0.95f;
+
+        simd::float_4 lowShape = simd::clamp(shape * 500.f, 0.f, 1.f);
+        lowShape = lowShape * lowShape * (3.f - 2.f * lowShape);
+        return baseSaw + (shaped - baseSaw) * lowShape;
+    }
+
+    static simd::float_4 pwmWithPolyBLEP(simd::float_4 phase, simd::float_4 pulseWidth, simd::float_4 freq, float sampleRate) {
+        pulseWidth = simd::clamp(pulseWidth, 0.05f, 0.95f);
+        simd::float_4 output = simd::ifelse(phase < pulseWidth, 1.f, -1.f);
+        simd::float_4 dt = freq / sampleRate;
+
+        // Both edges only ever hit the t in [0, 1) branch of polyBLEP()
+        simd::float_4 rising = phase < dt;
+        simd::float_4 falling = ~rising & (phase > pulseWidth) & (phase < pulseWidth + dt);
+        simd::float_4 tRise = phase / dt;
+        simd::float_4 tFall = (phase - pulseWidth) / dt;
+        output -= simd::ifelse(rising, tRise + tRise - tRise * tRise - 1.f, 0.f);
+        output += simd::ifelse(falling, tFall + tFall - tFall * tFall - 1.f, 0.f);
+        return output;
+    }
 };
 
 }} // namespace shapetaker::dsp
@@ -0,0 +1,588 @@
+#pragma once
+#include <rack.hpp>
+#include <algorithm>
+#include <cmath>
+
+using namespace rack;
+
+namespace shapetaker {
+namespace dsp {
+
+// ============================================================================
+// OVERSAMPLING UTILITIES
+// ============================================================================
+//
+// Cascaded polyphase IIR halfband stages (two parallel allpass chains per
+// stage, after Valenzuela/Constantinides and de Soras' HIIR). Each 2x stage
+// costs one multiply per allpass section per base-rate sample and direction,
+// so 4x/8x cascades stay cheap: later stages only need to reject images far
+// from the audio band and get by with a fraction of the first stage's order.
+//
+// A linear-phase alternative uses Kaiser-windowed FIR halfbands in the same
+// polyphase form: every other tap of a halfband is zero, so one branch is a
+// plain delay and the other a symmetric FIR run at the low rate. It costs
+// more and adds more latency, but the delay is the same at every frequency,
+// so a dry signal delayed by getLatency() lines up exactly with the wet one.
+
+/**
+ * Designs the allpass coefficients of an elliptic halfband filter.
+ * Transition bandwidth is normalized to the oversampled rate, i.e. the
+ * passband ends at (0.25 - transition) * fsHigh and the stopband starts at
+ * (0.25 + transition) * fsHigh.
+ */
+class HalfbandDesigner {
+public:
+    static constexpr int MAX_COEFS = 12;
+
+    // Smallest coefficient count reaching the given stopband attenuation
+    static int computeCoefCount(float attenuationDb, float transition) {
+        double k = 0.0;
+        double q = 0.0;
+        computeTransitionParams(transition, k, q);
+        double attnP2 = std::pow(10.0, -attenuationDb / 10.0);
+        double a = attnP2 / (1.0 - attnP2);
+        int order = (int)std::ceil(std::log(a * a / 16.0) / std::log(q));
+        if ((order & 1) == 0) {
+            order++;
+        }
+        return rack::math::clamp((order - 1) / 2, 1, MAX_COEFS);
+    }
+
+    static void design(float* coefs, int count, float transition) {
+        double k = 0.0;
+        double q = 0.0;
+        computeTransitionParams(transition, k, q);
+        const int order = count * 2 + 1;
+        for (int i = 0; i < count; ++i) {
+            const int c = i + 1;
+            double num = accumulateNumerator(q, order, c) * std::pow(q, 0.25);
+            double den = accumulateDenominator(q, order, c) + 0.5;
+            double ww = num / den;
+            double wwsq = ww * ww;
+            double x = std::sqrt((1.0 - wwsq * k) * (1.0 - wwsq / k)) / (1.0 + wwsq);
+            coefs[i] = (float)((1.0 - x) / (1.0 + x));
+        }
+    }
+
+private:
+    static double integerPow(double x, int n) {
+        double z = 1.0;
+        while (n > 0) {
+            if (n & 1) {
+                z *= x;
+            }
+            n >>= 1;
+            x *= x;
+        }
+        return z;
+    }
+
+    static void computeTransitionParams(double transition, double& k, double& q) {
+        transition = rack::math::clamp((float)transition, 1e-4f, 0.2499f);
+        k = std::tan((1.0 - transition * 2.0) * M_PI / 4.0);
+        k *= k;
+        double kksqrt = std::pow(1.0 - k * k, 0.25);
+        double e = 0.5 * (1.0 - kksqrt) / (1.0 + kksqrt);
+        double e4 = e * e * e * e;
+        q = e * (1.0 + e4 * (2.0 + e4 * (15.0 + 150.0 * e4)));
+    }
+
+    static double accumulateNumerator(double q, int order, int c) {
+        double acc = 0.0;
+        double term = 0.0;
+        int sign = 1;
+        int i = 0;
+        do {
+            term = integerPow(q, i * (i + 1)) * std::sin((i * 2 + 1) * c * M_PI / order) * sign;
+            acc += term;
+            sign = -sign;
+            ++i;
+        } while (std::fabs(term) > 1e-100);
+        return acc;
+    }
+
+    static double accumulateDenominator(double q, int order, int c) {
+        double acc = 0.0;
+        double term = 0.0;
+        int sign = -1;
+        int i = 1;
+        do {
+            term = integerPow(q, i * i) * std::cos(i * 2 * c * M_PI / order) * sign;
+            acc += term;
+            sign = -sign;
+            ++i;
+        } while (std::fabs(term) > 1e-100);
+        return acc;
+    }
+};
+
+// One halfband stage: even coefficients form path 0, odd coefficients path 1.
+// Each section is a first-order allpass (c + z^-1) / (1 + c z^-1) at the low rate.
+// T is float, or simd::float_4 for four independent channels.
+template <typename T>
+class HalfbandStageT {
+public:
+    static constexpr int MAX_COEFS = HalfbandDesigner::MAX_COEFS;
+
+    void setCoefficients(const float* newCoefs, int count) {
+        numCoefs = rack::math::clamp(count, 0, MAX_COEFS);
+        for (int i = 0; i < numCoefs; ++i) {
+            coefs[i] = newCoefs[i];
+        }
+        reset();
+    }
+
+    void reset() {
+        for (int i = 0; i < MAX_COEFS; ++i) {
+            x1[i] = 0.f;
+            y1[i] = 0.f;
+        }
+    }
+
+    // 1 sample in, 2 samples out
+    void upsample(T input, T* out) {
+        T path0 = input;
+        T path1 = input;
+        for (int i = 0; i < numCoefs; i += 2) {
+            path0 = allpass(i, path0);
+        }
+        for (int i = 1; i < numCoefs; i += 2) {
+            path1 = allpass(i, path1);
+        }
+        out[0] = path0;
+        out[1] = path1;
+    }
+
+    // 2 samples in, 1 sample out
+    T downsample(const T* in) {
+        T path0 = in[1];
+        T path1 = in[0];
+        for (int i = 0; i < numCoefs; i += 2) {
+            path0 = allpass(i, path0);
+        }
+        for (int i = 1; i < numCoefs; i += 2) {
+            path1 = allpass(i, path1);
+        }
+        return 0.5f * (path0 + path1);
+    }
+
+    // Group delay at DC in high-rate samples
+    float getLatency() const {
+        float delay0 = 0.f;
+        float delay1 = 0.f;
+        for (int i = 0; i < numCoefs; ++i) {
+            float d = 2.f * (1.f - coefs[i]) / (1.f + coefs[i]);
+            if ((i & 1) == 0) {
+                delay0 += d;
+            } else {
+                delay1 += d;
+            }
+        }
+        return 0.5f * (delay0 + delay1 + 1.f);
+    }
+
+private:
+    float coefs[MAX_COEFS] = {};
+    T x1[MAX_COEFS] = {};
+    T y1[MAX_COEFS] = {};
+    int numCoefs = 0;
+
+    inline T allpass(int i, T x) {
+        T y = coefs[i] * (x - y1[i]) + x1[i];
+        x1[i] = x;
+        y1[i] = y;
+        return y;
+    }
+};
+
+template <typename T>
+constexpr int HalfbandStageT<T>::MAX_COEFS;
+
+using HalfbandStage = HalfbandStageT<float>;
+
+/**
+ * Designs the odd-phase taps of a linear-phase FIR halfband filter with a
+ * Kaiser window. Transition is normalized as in HalfbandDesigner. The full
+ * filter has 2 * count - 1 taps: the centre tap is 0.5, the taps returned
+ * here sit at odd offsets from it and all remaining taps are zero.
+ */
+class HalfbandFirDesigner {
+public:
+    static constexpr int MAX_TAPS = 80;
+    // Kaiser's estimates fall a few dB short on short filters
+    static constexpr float DESIGN_MARGIN_DB = 6.f;
+
+    // Smallest (even) tap count reaching the given stopband attenuation
+    static int computeTapCount(float attenuationDb, float transition) {
+        transition = rack::math::clamp(transition, 1e-3f, 0.2499f);
+        // Kaiser's length estimate, with the stopband-to-passband width in radians
+        double width = 2.0 * M_PI * 2.0 * transition;
+        double length = (attenuationDb + DESIGN_MARGIN_DB - 7.95) / (2.285 * width) + 1.0;
+        // Halfband lengths are 4k - 1, of which 2k taps are non-zero
+        int k = (int)std::ceil((length + 1.0) / 4.0);
+        return rack::math::clamp(2 * k, 2, MAX_TAPS);
+    }
+
+    static void design(float* taps, int count, float attenuationDb) {
+        const int half = count - 1; // centre offset of the outermost taps
+        const double beta = kaiserBeta(attenuationDb + DESIGN_MARGIN_DB);
+        const double norm = 1.0 / besselI0(beta);
+        double sum = 0.0;
+        double h[MAX_TAPS];
+        for (int i = 0; i < count; ++i) {
+            const int n = 2 * i - half;
+            double ratio = (double)n / half;
+            double window = besselI0(beta * std::sqrt(std::max(0.0, 1.0 - ratio * ratio))) * norm;
+            h[i] = std::sin(M_PI * n * 0.5) / (M_PI * n) * window;
+            sum += h[i];
+        }
+        // The odd taps of a unity-gain halfband add up to one half
+        for (int i = 0; i < count; ++i) {
+            taps[i] = (float)(h[i] * 0.5 / sum);
+        }
+    }
+
+private:
+    static double kaiserBeta(double attenuationDb) {
+        if (attenuationDb > 50.0) {
+            return 0.1102 * (attenuationDb - 8.7);
+        }
+        if (attenuationDb > 21.0) {
+            return 0.5842 * std::pow(attenuationDb - 21.0, 0.4) + 0.07886 * (attenuationDb - 21.0);
+        }
+        return 0.0;
+    }
+
+    static double besselI0(double x) {
+        double sum = 1.0;
+        double term = 1.0;
+        double halfX = 0.5 * x;
+        for (int k = 1; k < 64 && term > 1e-12 * sum; ++k) {
+            term *= (halfX / k) * (halfX / k);
+            sum += term;
+        }
+        return sum;
+    }
+};
+
+// Linear-phase halfband stage in polyphase form. The odd-phase branch is a
+// symmetric FIR of `count` taps at the low rate; the centre-tap branch is a
+// delay of count / 2 - 1 (up) or count / 2 (down) low-rate samples. Latency
+// is count - 1 high-rate samples per direction. T is float or simd::float_4.
+template <typename T>
+class HalfbandFirStageT {
+public:
+    static constexpr int MAX_TAPS = HalfbandFirDesigner::MAX_TAPS;
+
+    void setTaps(const float* newTaps, int count) {
+        numTaps = rack::math::clamp(count & ~1, 2, MAX_TAPS);
+        for (int i = 0; i < numTaps; ++i) {
+            taps[i] = newTaps[i];
+        }
+        reset();
+    }
+
+    void reset() {
+        for (int i = 0; i < 2 * MAX_TAPS; ++i) {
+            branch[i] = 0.f;
+            centre[i] = 0.f;
+        }
+        pos = 0;
+    }
+
+    // 1 sample in, 2 samples out
+    void upsample(T input, T* out) {
+        advance();
+        branch[pos] = branch[pos + numTaps] = input;
+        out[0] = 2.f * convolve();
+        out[1] = branch[pos + numTaps / 2 - 1];
+    }
+
+    // 2 samples in, 1 sample out
+    T downsample(const T* in) {
+        advance();
+        branch[pos] = branch[pos + numTaps] = in[0];
+        centre[pos] = centre[pos + numTaps] = in[1];
+        return convolve() + 0.5f * centre[pos + numTaps / 2];
+    }
+
+    // Group delay in high-rate samples, the same at every frequency
+    float getLatency() const {
+        return (float)(numTaps - 1);
+    }
+
+private:
+    float taps[MAX_TAPS] = {};
+    // Histories are stored twice so the newest numTaps samples are contiguous from pos
+    T branch[2 * MAX_TAPS] = {};
+    T centre[2 * MAX_TAPS] = {};
+    int numTaps = 2;
+    int pos = 0;
+
+    inline void advance() {
+        pos = pos == 0 ? numTaps - 1 : pos - 1;
+    }
+
+    inline T convolve() const {
+        const T* x = branch + pos;
+        T acc = 0.f;
+        for (int i = 0; i < numTaps / 2; ++i) {
+            acc += taps[i] * (x[i] + x[numTaps - 1 - i]);
+        }
+        return acc;
+    }
+};
+
+template <typename T>
+constexpr int HalfbandFirStageT<T>::MAX_TAPS;
+
+/**
+ * 1x/2x/4x/8x oversampler built from cascaded halfband stages.
+ * Upsampling and decimation keep separate state, so modules that generate
+ * their signal at the high rate (oscillators) only use downsample().
+ * Oversampler works on float; Oversampler4 runs four channels in the lanes
+ * of a simd::float_4 with the same filters.
+ *
+ * With linear phase the stages are FIR halfbands and the decimator pads the
+ * round trip to a whole number of base-rate samples, so getLatency() is an
+ * integer and a plain delay aligns a dry path with the wet one.
+ */
+template <typename T>
+class OversamplerT {
+public:
+    enum Quality {
+        QUALITY_ECO = 0,      // ~60 dB image rejection
+        QUALITY_STANDARD = 1, // ~90 dB
+        QUALITY_HIGH = 2,     // ~120 dB
+        QUALITY_COUNT
+    };
+
+    static constexpr int MAX_STAGES = 3;
+    static constexpr int MAX_FACTOR = 1 << MAX_STAGES;
+    // Audio band kept intact, as a fraction of the base sample rate
+    static constexpr float PASSBAND_EDGE = 0.44f;
+
+    static float attenuationForQuality(int quality) {
+        switch (quality) {
+            case QUALITY_ECO: return 60.f;
+            case QUALITY_HIGH: return 120.f;
+            default: return 90.f;
+        }
+    }
+
+    // Rounds down to the nearest supported power of two
+    static int sanitizeFactor(int factor) {
+        int supported = 1;
+        while (supported * 2 <= factor && supported < MAX_FACTOR) {
+            supported *= 2;
+        }
+        return supported;
+    }
+
+    void configure(int newFactor, int newQuality = QUALITY_STANDARD, bool newLinearPhase = false) {
+        newFactor = sanitizeFactor(newFactor);
+        newQuality = rack::math::clamp(newQuality, 0, QUALITY_COUNT - 1);
+        if (newFactor == factor && newQuality == quality && newLinearPhase == linearPhase) {
+            return;
+        }
+        factor = newFactor;
+        quality = newQuality;
+        linearPhase = newLinearPhase;
+        numStages = 0;
+        while ((1 << numStages) < factor) {
+            numStages++;
+        }
+
+        // Stage s runs from 2^s to 2^(s+1) times the base rate; only the first
+        // stage has to keep its transition band tight against the audio band.
+        float attenuation = attenuationForQuality(quality);
+        int stageLatency = 0; // round trip, in samples at the top rate
+        for (int s = 0; s < numStages; ++s) {
+            float transition = 0.25f - PASSBAND_EDGE / (float)(2 << s);
+            if (linearPhase) {
+                int count = HalfbandFirDesigner::computeTapCount(attenuation, transition);
+                float taps[HalfbandFirDesigner::MAX_TAPS];
+                HalfbandFirDesigner::design(taps, count, attenuation);
+                firUpStages[s].setTaps(taps, count);
+                firDownStages[s].setTaps(taps, count);
+                stageLatency += 2 * (count - 1) * (factor >> (s + 1));
+            } else {
+                int count = HalfbandDesigner::computeCoefCount(attenuation, transition);
+                float coefs[HalfbandDesigner::MAX_COEFS];
+                HalfbandDesigner::design(coefs, count, transition);
+                upStages[s].setCoefficients(coefs, count);
+                downStages[s].setCoefficients(coefs, count);
+            }
+        }
+        padding = linearPhase ? (factor - stageLatency % factor) % factor : 0;
+        reset();
+    }
+
+    void reset() {
+        for (int s = 0; s < MAX_STAGES; ++s) {
+            upStages[s].reset();
+            downStages[s].reset();
+            firUpStages[s].reset();
+            firDownStages[s].reset();
+        }
+        for (int i = 0; i < MAX_FACTOR; ++i) {
+            paddingLine[i] = 0.f;
+        }
+    }
+
+    int getFactor() const {
+        return factor;
+    }
+
+    int getQuality() const {
+        return quality;
+    }
+
+    bool isLinearPhase() const {
+        return linearPhase;
+    }
+
+    // Round-trip (upsample + downsample) group delay at DC, in base-rate
+    // samples; exact at all frequencies and a whole number with linear phase
+    float getLatency() const {
+        float latency = (float)padding / (float)factor;
+        for (int s = 0; s < numStages; ++s) {
+            float stageRate = (float)(2 << s);
+            if (linearPhase) {
+                latency += (firUpStages[s].getLatency() + firDownStages[s].getLatency()) / stageRate;
+            } else {
+                latency += (upStages[s].getLatency() + downStages[s].getLatency()) / stageRate;
+            }
+        }
+        return latency;
+    }
+
+    // 1 sample in, getFactor() samples out
+    void upsample(T input, T* out) {
+        T work[MAX_FACTOR];
+        out[0] = input;
+        int length = 1;
+        for (int s = 0; s < numStages; ++s) {
+            for (int i = 0; i < length; ++i) {
+                work[i] = out[i];
+            }
+            for (int i = 0; i < length; ++i) {
+                if (linearPhase) {
+                    firUpStages[s].upsample(work[i], &out[2 * i]);
+                } else {
+                    upStages[s].upsample(work[i], &out[2 * i]);
+                }
+            }
+            length *= 2;
+        }
+    }
+
+    // getFactor() samples in, 1 sample out
+    T downsample(const T* in) {
+        if (numStages == 0) {
+            return in[0];
+        }
+        // Top-rate padding delay first: the oldest `padding` samples come out
+        // of paddingLine, the newest go back into it
+        T work[2 * MAX_FACTOR];
+        int length = factor;
+        for (int i = 0; i < padding; ++i) {
+            work[i] = paddingLine[i];
+        }
+        for (int i = 0; i < length; ++i) {
+            work[padding + i] = in[i];
+        }
+        for (int i = 0; i < padding; ++i) {
+            paddingLine[i] = work[length + i];
+        }
+        for (int s = numStages - 1; s >= 0; --s) {
+            length /= 2;
+            for (int i = 0; i < length; ++i) {
+                work[i] = linearPhase ? firDownStages[s].downsample(&work[2 * i])
+                                      : downStages[s].downsample(&work[2 * i]);
+            }
+        }
+        return work[0];
+    }
+
+    // Block variants: `out` holds frames * getFactor() samples
+    void upsampleBlock(const T* in, T* out, int frames) {
+        for (int i = 0; i < frames; ++i) {
+            upsample(in[i], out + i * factor);
+        }
+    }
+
+    // `in` holds frames * getFactor() samples
+    void downsampleBlock(const T* in, T* out, int frames) {
+        for (int i = 0; i < frames; ++i) {
+            out[i] = downsample(in + i * factor);
+        }
+    }
+
+private:
+    HalfbandStageT<T> upStages[MAX_STAGES];
+    HalfbandStageT<T> downStages[MAX_STAGES];
+    HalfbandFirStageT<T> firUpStages[MAX_STAGES];
+    HalfbandFirStageT<T> firDownStages[MAX_STAGES];
+    T paddingLine[MAX_FACTOR] = {};
+    int factor = 1;
+    int quality = -1;
+    int numStages = 0;
+    int padding = 0;
+    bool linearPhase = false;
+};
+
+template <typename T>
+constexpr int OversamplerT<T>::MAX_STAGES;
+template <typename T>
+constexpr int OversamplerT<T>::MAX_FACTOR;
+template <typename T>
+constexpr float OversamplerT<T>::PASSBAND_EDGE;
+
+using Oversampler = OversamplerT<float>;
+using Oversampler4 = OversamplerT<simd::float_4>;
+
+/**
+ * Whole-sample delay that lines a dry path up with an oversampler's round
+ * trip, so dry/wet mixes do not comb. Delays up to MAX_DELAY - 1 samples.
+ */
+template <typename T>
+class LatencyDelayT {
+public:
+    static constexpr int MAX_DELAY = 128; // power of two
+
+    void setDelay(int samples) {
+        delay = rack::math::clamp(samples, 0, MAX_DELAY - 1);
+    }
+
+    int getDelay() const {
+        return delay;
+    }
+
+    void reset() {
+        for (int i = 0; i < MAX_DELAY; ++i) {
+            buffer[i] = 0.f;
+        }
+        pos = 0;
+    }
+
+    T process(T input) {
+        buffer[pos] = input;
+        T output = buffer[(pos - delay) & (MAX_DELAY - 1)];
+        pos = (pos + 1) & (MAX_DELAY - 1);
+        return output;
+    }
+
+private:
+    T buffer[MAX_DELAY] = {};
+    int delay = 0;
+    int pos = 0;
+};
+
+template <typename T>
+constexpr int LatencyDelayT<T>::MAX_DELAY;
+
+using LatencyDelay = LatencyDelayT<float>;
+using LatencyDelay4 = LatencyDelayT<simd::float_4>;
+
+}} // namespace shapetaker::dsp
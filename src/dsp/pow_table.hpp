@@ -0,0 +1,122 @@
+#pragma once
+#include <rack.hpp>
+#include <cmath>
+
+using namespace rack;
+
+namespace shapetaker {
+namespace dsp {
+
+// ============================================================================
+// POWER LOOKUP TABLE
+// ============================================================================
+
+/**
+ * Bilinear table of pow(t, exponent) for t in [0, 1] and exponents in
+ * [EXP_MIN, EXP_MAX], for envelope curves and wave shaping where pow() per
+ * sample is too slow. Arguments outside the ranges are clamped; t = 0 and
+ * t = 1 are exact.
+ *
+ * Small exponents make the curve too steep near t = 0 for linear
+ * interpolation (t^0.2 is off by 0.18 in the first cell), so t below
+ * EXACT_BELOW goes to std::pow. Everywhere else the error is below 1.5e-3
+ * for exponents >= 0.2 and below 1e-4 for exponents >= 1.
+ *
+ * There is a single shared instance. plugin init() builds it, so no audio
+ * thread ever pays for the fill and no two threads race on it.
+ */
+class PowTable {
+public:
+    static constexpr int T_SIZE = 256;
+    static constexpr int EXP_SIZE = 128;
+    static constexpr float EXP_MIN = 0.05f;
+    static constexpr float EXP_MAX = 5.f;
+    static constexpr float EXACT_BELOW = 2.f / (T_SIZE - 1);
+
+    // Function-local static: built once, thread-safe under C++11
+    static const PowTable& shared() {
+        static const PowTable table;
+        return table;
+    }
+
+    float lookup(float t, float exponent) const {
+        t = rack::math::clamp(t, 0.f, 1.f);
+        exponent = rack::math::clamp(exponent, EXP_MIN, EXP_MAX);
+        if (t <= 0.f) {
+            return 0.f;
+        }
+        if (t >= 1.f) {
+            return 1.f;
+        }
+        if (t < EXACT_BELOW) {
+            return std::pow(t, exponent);
+        }
+
+        float ePos = (exponent - EXP_MIN) * (EXP_SIZE - 1) / (EXP_MAX - EXP_MIN);
+        int eIdx = rack::math::clamp((int)ePos, 0, EXP_SIZE - 2);
+        float eFrac = ePos - (float)eIdx;
+
+        float tPos = t * (T_SIZE - 1);
+        int tIdx = rack::math::clamp((int)tPos, 0, T_SIZE - 2);
+        float tFrac = tPos - (float)tIdx;
+
+        const float* row = table[eIdx] + tIdx;
+        float v0 = rack::math::crossfade(row[0], row[1], tFrac);
+        float v1 = rack::math::crossfade(row[T_SIZE], row[T_SIZE + 1], tFrac);
+        return rack::math::crossfade(v0, v1, eFrac);
+    }
+
+    // Four lookups: indices and interpolation in vector lanes, corner values
+    // gathered per lane
+    simd::float_4 lookup(simd::float_4 t, simd::float_4 exponent) const {
+        t = simd::clamp(t, 0.f, 1.f);
+        exponent = simd::clamp(exponent, EXP_MIN, EXP_MAX);
+
+        simd::float_4 ePos = (exponent - EXP_MIN) * (float)(EXP_SIZE - 1) / (EXP_MAX - EXP_MIN);
+        simd::float_4 eIdx = simd::clamp(simd::floor(ePos), 0.f, (float)(EXP_SIZE - 2));
+        simd::float_4 eFrac = ePos - eIdx;
+
+        simd::float_4 tPos = t * (float)(T_SIZE - 1);
+        simd::float_4 tIdx = simd::clamp(simd::floor(tPos), 0.f, (float)(T_SIZE - 2));
+        simd::float_4 tFrac = tPos - tIdx;
+
+        simd::float_4 v00, v01, v10, v11;
+        for (int i = 0; i < 4; ++i) {
+            const float* row = table[(int)eIdx[i]] + (int)tIdx[i];
+            v00[i] = row[0];
+            v01[i] = row[1];
+            v10[i] = row[T_SIZE];
+            v11[i] = row[T_SIZE + 1];
+        }
+
+        simd::float_4 v0 = v00 + (v01 - v00) * tFrac;
+        simd::float_4 v1 = v10 + (v11 - v10) * tFrac;
+        simd::float_4 result = v0 + (v1 - v0) * eFrac;
+        if (simd::movemask(t < EXACT_BELOW)) {
+            for (int i = 0; i < 4; ++i) {
+                if (t[i] < EXACT_BELOW) {
+                    result[i] = std::pow(t[i], exponent[i]);
+                }
+            }
+        }
+        return simd::ifelse(t <= 0.f, 0.f, simd::ifelse(t >= 1.f, 1.f, result));
+    }
+
+private:
+    float table[EXP_SIZE][T_SIZE];
+
+    PowTable() {
+        for (int ei = 0; ei < EXP_SIZE; ++ei) {
+            float expVal = EXP_MIN + (EXP_MAX - EXP_MIN) * ((float)ei / (EXP_SIZE - 1));
+            for (int ti = 0; ti < T_SIZE; ++ti) {
+                float tVal = (float)ti / (T_SIZE - 1);
+                table[ei][ti] = std::pow(tVal, expVal);
+            }
+        }
+    }
+
+    PowTable(const PowTable&) = delete;
+    PowTable& operator=(const PowTable&) = delete;
+};
+
+}} // namespace shapetaker::dsp
@@ -0,0 +1,109 @@
+#pragma once
+#include <rack.hpp>
+#include <algorithm>
+#include <cmath>
+
+using namespace rack;
+
+namespace shapetaker {
+namespace dsp {
+
+// ============================================================================
+// SILENCE SLEEP
+// ============================================================================
+
+/**
+ * Lets an effect stop running its DSP once its input is silent and its tail
+ * has died away. Ask asleep() at the top of process() with the peak of the
+ * audio inputs; while it returns true, write zeros and skip the DSP. After
+ * the DSP has run, observe() the peak of the inputs together with the
+ * module's internal level (wet signal, delay taps, outputs). Once that has
+ * stayed below the threshold for the module's tail time, the module sleeps.
+ *
+ *     silence.setTailSeconds(longestDelaySeconds + 0.05f);
+ *     if (silence.asleep(inputPeak)) {
+ *         // zero the outputs
+ *         return;
+ *     }
+ *     ... DSP ...
+ *     silence.observe(std::max(inputPeak, tailPeak), args.sampleTime);
+ *
+ * The tail time has to cover the longest stretch the observed level can sit
+ * below the threshold while the module still holds audible state, such as
+ * the gap between echoes of a delay line.
+ *
+ * Nothing is cleared when a module falls asleep. Its state is frozen with
+ * whatever sub-threshold residue it held, and the first input sample above
+ * the threshold wakes it on that same sample. The DSP then carries on from
+ * where it stopped. Either transition is a step no larger than the threshold
+ * (-120 dB re 5 V), so no fade is applied and attacks pass through intact.
+ */
+class SilenceSleep {
+public:
+    static constexpr float DEFAULT_THRESHOLD = 5e-6f;  // -120 dB re 5 V
+    static constexpr float DEFAULT_TAIL_SECONDS = 0.1f;
+
+    void setEnabled(bool newEnabled) {
+        enabled = newEnabled;
+        if (!enabled) {
+            wake();
+        }
+    }
+
+    bool isEnabled() const {
+        return enabled;
+    }
+
+    void setThreshold(float newThreshold) {
+        threshold = std::max(newThreshold, 0.f);
+    }
+
+    void setTailSeconds(float seconds) {
+        tailSeconds = std::max(seconds, 0.f);
+    }
+
+    // Back to full processing; the tail timer starts over
+    void wake() {
+        sleeping = false;
+        quietSeconds = 0.f;
+    }
+
+    // True while the module may skip its DSP. Input above the threshold
+    // wakes it before returning.
+    bool asleep(float inputPeak) {
+        if (sleeping && !(inputPeak <= threshold)) {
+            wake();
+        }
+        return sleeping;
+    }
+
+    // NaN counts as signal, so a blown-up state never goes to sleep
+    void observe(float peak, float sampleTime) {
+        if (!enabled || !(peak <= threshold)) {
+            quietSeconds = 0.f;
+            return;
+        }
+        quietSeconds += sampleTime;
+        if (quietSeconds >= tailSeconds) {
+            sleeping = true;
+        }
+    }
+
+private:
+    bool enabled = true;
+    bool sleeping = false;
+    float threshold = DEFAULT_THRESHOLD;
+    float tailSeconds = DEFAULT_TAIL_SECONDS;
+    float quietSeconds = 0.f;
+};
+
+// Largest |voltage| across a port's channels; 0 when nothing is connected
+inline float portPeak(engine::Port& port) {
+    float peak = 0.f;
+    for (int c = 0; c < port.getChannels(); ++c) {
+        peak = std::max(peak, std::fabs(port.getVoltage(c)));
+    }
+    return peak;
+}
+
+}} // namespace shapetaker::dsp
@@ -3,8 +3,10 @@
 #include <vector>
 #include <algorithm>
 #include <cmath>
+#include <atomic>
 #include <memory>
 #include <string>
+#include <utility>
 #include "ui/menu_helpers.hpp"
 
 // Forward declaration
@@ -162,6 +164,71 @@ struct Evocation : Module {
         float time;     // normalized time 0-1
     };
 
+    // Uniformly resampled copy of the point list so playback lookup is O(1)
+    // no matter how many points a gesture holds. The raw points stay the
+    // source of truth for editing, display and serialization.
+    struct EnvelopePlaybackTable {
+        static constexpr int SIZE = 2048;
+        float values[SIZE + 1] = {};
+        bool valid = false;
+
+        // Single sweep over the points, same segment rules as a linear search
+        void bake(const std::vector<EnvelopePoint>& points) {
+            valid = !points.empty();
+            if (!valid) {
+                return;
+            }
+            const size_t last = points.size() - 1;
+            size_t seg = 0;
+            for (int k = 0; k <= SIZE; ++k) {
+                float phase = (float)k / SIZE;
+                if (last == 0 || phase <= points[0].time) {
+                    values[k] = points[0].y;
+                    continue;
+                }
+                while (seg < last && points[seg + 1].time < phase) {
+                    seg++;
+                }
+                if (seg >= last) {
+                    values[k] = points[last].y;
+                    continue;
+                }
+                const EnvelopePoint& a = points[seg];
+                const EnvelopePoint& b = points[seg + 1];
+                float span = b.time - a.time;
+                values[k] = span > 0.f ? a.y + (phase - a.time) / span * (b.y - a.y) : b.y;
+            }
+        }
+
+        float lookup(float phase) const {
+            if (!valid) {
+                return 0.f;
+            }
+            float pos = clamp(phase, 0.f, 1.f) * SIZE;
+            int index = std::min((int)pos, SIZE - 1);
+            float frac = pos - index;
+            return values[index] + frac * (values[index + 1] - values[index]);
+        }
+    };
+
+    // Immutable envelope handed to the audio thread (RCU style). The UI thread
+    // edits `envelope`, publishEnvelope() builds a fresh snapshot and swaps it
+    // in with one atomic exchange; process() only ever reads the snapshot.
+    struct EnvelopeSnapshot {
+        std::vector<EnvelopePoint> points;
+        EnvelopePlaybackTable table;
+        float duration = 2.0f;
+        bool hasData = false;
+    };
+
+    // Edits requested from process() and applied on the UI thread
+    enum PendingEdit {
+        EDIT_REGENERATE_ADSR = 1 << 0,
+        EDIT_TRIM_LEAD = 1 << 1,
+        EDIT_TRIM_TAIL = 1 << 2,
+        EDIT_STOP_RECORDING = 1 << 3
+    };
+
     enum class EditableParam : int {
         Speed = 0,
         Loop,
@@ -198,8 +265,17 @@ struct Evocation : Module {
     int currentEnvelopeIndex = 0;
     int currentParameterIndex = 0;
 
-    std::vector<EnvelopePoint> envelope;
+    std::vector<EnvelopePoint> envelope; // editing copy, UI thread only
     std::vector<EnvelopePoint> gestureEnvelopeBackup;
+
+    std::atomic<EnvelopeSnapshot*> publishedSnapshot{nullptr};
+    // Bumped at the start of every process(); a retired snapshot is safe to
+    // free once the counter has moved past its retirement value
+    std::atomic<uint64_t> audioEpoch{0};
+    std::vector<std::pair<EnvelopeSnapshot*, uint64_t>> retiredSnapshots; // UI thread only
+    const EnvelopeSnapshot* audioSnapshot = nullptr; // valid inside process() only
+    std::atomic<int> pendingEdits{0};
+    std::atomic<bool> triggerAllRequested{false}; // touch strip -> process()
     float gestureDurationBackup = 2.0f;
     bool gestureBufferHasDataBackup = false;
     bool isRecording = false;
@@ -305,6 +381,10 @@ struct Evocation : Module {
         if (debugTouchLogging) {
             INFO("Evocation::~Evocation envelopeSize=%zu bufferHasData=%d", envelope.size(), bufferHasData);
         }
+        delete publishedSnapshot.exchange(nullptr);
+        for (auto& retired : retiredSnapshots) {
+            delete retired.first;
+        }
     }
     
     Evocation() {
@@ -405,6 +485,7 @@ struct Evocation : Module {
         configOutput(ENV_4_GATE_OUTPUT, "Envelope 4 Gate");
 
         resetADSREngine();
+        publishEnvelope();
 
         // Initialize smoothers to current knob defaults
         for (int i = 0; i < NUM_ENVELOPES; ++i) {
@@ -416,6 +497,17 @@ struct Evocation : Module {
     }
     
     void process(const ProcessArgs& args) override {
+        // Pick up the latest published envelope; order matters for reclamation
+        audioEpoch.fetch_add(1);
+        audioSnapshot = publishedSnapshot.load();
+        if (settings::headless) {
+            // No UI thread to hand edits to
+            applyPendingEdits();
+        }
+        if (triggerAllRequested.load(std::memory_order_relaxed) && triggerAllRequested.exchange(false)) {
+            triggerAllEnvelopes();
+        }
+
         // Handle triggers using shared helpers
         bool triggerButtonPressed = triggerTrigger.process(params[TRIGGER_PARAM].getValue());
         bool trimLeadPressed = trimLeadButtonTrigger.process(params[TRIM_LEAD_PARAM].getValue());
@@ -574,7 +666,7 @@ struct Evocation : Module {
                 }
 
                 if (changed) {
-                    generateADSREnvelope();
+                    requestEdit(EDIT_REGENERATE_ADSR);
                 }
             }
         }
@@ -599,14 +691,10 @@ struct Evocation : Module {
         
         // Handle gesture trim buttons
         if (trimLeadPressed) {
-            if (!trimGestureLeadingSilence()) {
-                updateLastTouched("", "NO TRIM");
-            }
+            requestEdit(EDIT_TRIM_LEAD);
         }
         if (trimTailPressed) {
-            if (!trimGestureTrailingSilence()) {
-                updateLastTouched("", "NO TRIM");
-            }
+            requestEdit(EDIT_TRIM_TAIL);
         }
 
         // Update recording during gesture capture
@@ -631,11 +719,12 @@ struct Evocation : Module {
             currentGateChannels = detectedGateChannels;
 
             // Manually pressed trigger button fires all voices
-            if (triggerButtonPressed && bufferHasData) {
+            bool hasEnvelope = audioHasEnvelope();
+            if (triggerButtonPressed && hasEnvelope) {
                 triggerAllEnvelopes();
             }
 
-            if (detectedTriggerChannels > 0 && bufferHasData) {
+            if (detectedTriggerChannels > 0 && hasEnvelope) {
                 // Handle polyphonic trigger input
                 // Process triggers for each input channel
                 for (int c = 0; c < detectedTriggerChannels; c++) {
@@ -652,14 +741,14 @@ struct Evocation : Module {
                     adsrGateHeld[c] = false;
                     previousGateHigh[c] = false;
                 }
-            } else if (detectedGateChannels > 0 && bufferHasData) {
+            } else if (detectedGateChannels > 0 && hasEnvelope) {
                 // Handle polyphonic gate input (for gate mode)
                 // Process each polyphonic channel
                 for (int c = 0; c < detectedGateChannels; c++) {
                     bool gateHigh = inputs[GATE_INPUT].getPolyVoltage(c) >= 1.0f;
 
                     // Start playback on gate rising edge
-                    if (gateHigh && !previousGateHigh[c] && bufferHasData) {
+                    if (gateHigh && !previousGateHigh[c] && hasEnvelope) {
                         bool forceRestart = (mode == EnvelopeMode::GESTURE);
                         triggerEnvelope(c, forceRestart);
                     }
@@ -769,6 +858,7 @@ struct Evocation : Module {
         recordingTime = 0.0f;
         bufferHasData = false;
         envelope.clear();
+        publishEnvelope();
         stopAllPlayback();
         firstSampleTime = -1.0f;
         if (touchStripWidget) {
@@ -809,6 +899,7 @@ struct Evocation : Module {
             bufferHasData = false;
             recordedDuration = 2.0f;
         }
+        publishEnvelope();
 
         firstSampleTime = -1.0f;
     }
@@ -818,7 +909,7 @@ struct Evocation : Module {
         
         // Stop recording if max time reached
         if (recordingTime >= maxRecordingTime) {
-            stopRecording();
+            requestEdit(EDIT_STOP_RECORDING);
         }
     }
     
@@ -964,6 +1055,7 @@ struct Evocation : Module {
         normalizeEnvelopeTiming();
 
         recordedDuration = std::max(recordedDuration * remaining, 1e-3f);
+        publishEnvelope();
         gestureEnvelopeBackup = envelope;
         gestureDurationBackup = recordedDuration;
         gestureBufferHasDataBackup = bufferHasData;
@@ -1023,6 +1115,7 @@ struct Evocation : Module {
         normalizeEnvelopeTiming();
 
         recordedDuration = std::max(recordedDuration * lastTime, 1e-3f);
+        publishEnvelope();
         gestureEnvelopeBackup = envelope;
         gestureDurationBackup = recordedDuration;
         gestureBufferHasDataBackup = bufferHasData;
@@ -1038,6 +1131,7 @@ struct Evocation : Module {
         stopAllPlayback();
         firstSampleTime = -1.0f;
         recordedDuration = 2.0f;
+        publishEnvelope();
 
         if (debugTouchLogging) {
             INFO("Evocation::clearBuffer");
@@ -1064,8 +1158,9 @@ struct Evocation : Module {
         }
     }
     
+    // Audio thread only; the UI asks for it with requestTriggerAll()
     void triggerAllEnvelopes() {
-        if (!bufferHasData) return;
+        if (!audioHasEnvelope()) return;
 
         if (mode == EnvelopeMode::ADSR) {
             for (int voice = 0; voice < MAX_POLY_CHANNELS; ++voice) {
@@ -1103,7 +1198,7 @@ struct Evocation : Module {
     }
 
     void triggerEnvelope(int channel, bool forceRestart = false) {
-        if (!bufferHasData || channel < 0 || channel >= MAX_POLY_CHANNELS) return;
+        if (!audioHasEnvelope() || channel < 0 || channel >= MAX_POLY_CHANNELS) return;
 
         // Get current output voltage to find smooth retrigger point
         float currentVoltage = 0.0f;
@@ -1145,20 +1240,21 @@ struct Evocation : Module {
     // Find the phase in the envelope that best matches the target voltage
     // This prevents clicks when retriggering
     float findPhaseForVoltage(float targetVoltage) {
-        if (envelope.empty()) return 0.0f;
+        if (!audioSnapshot || audioSnapshot->points.empty()) return 0.0f;
+        const std::vector<EnvelopePoint>& points = audioSnapshot->points;
 
         // Search for the earliest point in the envelope close to target voltage
         float bestPhase = 0.0f;
-        float bestDiff = std::abs(envelope[0].y - targetVoltage);
+        float bestDiff = std::abs(points[0].y - targetVoltage);
 
-        for (size_t i = 0; i < envelope.size(); i++) {
-            float diff = std::abs(envelope[i].y - targetVoltage);
+        for (size_t i = 0; i < points.size(); i++) {
+            float diff = std::abs(points[i].y - targetVoltage);
             if (diff < bestDiff) {
                 bestDiff = diff;
-                bestPhase = envelope[i].time;
+                bestPhase = points[i].time;
             }
             // Stop searching after we pass the target (prefer early phases)
-            if (envelope[i].y < targetVoltage && i > 0) {
+            if (points[i].y < targetVoltage && i > 0) {
                 break;
             }
         }
@@ -1198,7 +1294,7 @@ struct Evocation : Module {
     }
 
     void processADSRTriggers(bool manualTrigger, int detectedTriggerChannels, int detectedGateChannels) {
-        if (!bufferHasData)
+        if (!audioHasEnvelope())
             return;
 
         currentTriggerChannels = 0;
@@ -1516,7 +1612,7 @@ struct Evocation : Module {
     void processPlayback(int outputIndex, float sampleTime) {
         PlaybackState& pb = playback[outputIndex];
 
-        if (!bufferHasData) {
+        if (!audioHasEnvelope()) {
             outputs[ENV_1_OUTPUT + outputIndex].setChannels(0);
             outputs[ENV_1_EOC_OUTPUT + outputIndex].setChannels(0);
             outputs[ENV_1_GATE_OUTPUT + outputIndex].setChannels(0);
@@ -1606,7 +1702,7 @@ struct Evocation : Module {
             speed = cachedSpeed[outputIndex];
 
             // Advance phase
-            float envDuration = getEnvelopeDuration();
+            float envDuration = (mode == EnvelopeMode::GESTURE) ? audioSnapshot->duration : getEnvelopeDuration();
             float phaseIncrement = speed * sampleTime / envDuration;
             pb.phase[c] += phaseIncrement;
 
@@ -1701,25 +1797,76 @@ struct Evocation : Module {
         }
     }
     
-    float interpolateEnvelope(float phase) {
-        if (envelope.empty()) return 0.0f;
-        if (envelope.size() == 1) return envelope[0].y;
+    // Audio thread: lookup in the snapshot picked up by this process() call
+    float interpolateEnvelope(float phase) const {
+        return audioSnapshot ? audioSnapshot->table.lookup(phase) : 0.f;
+    }
+
+    bool audioHasEnvelope() const {
+        return audioSnapshot && audioSnapshot->hasData && !audioSnapshot->points.empty();
+    }
 
-        // If phase is before first point, return first point's value
-        if (phase <= envelope[0].time) {
-            return envelope[0].y;
+    // UI thread: call after any change to `envelope`, bufferHasData or
+    // recordedDuration that playback should hear. Never blocks the audio thread.
+    void publishEnvelope() {
+        EnvelopeSnapshot* next = new EnvelopeSnapshot;
+        next->points = envelope;
+        next->table.bake(envelope);
+        next->duration = getRecordedDuration();
+        next->hasData = bufferHasData;
+
+        EnvelopeSnapshot* previous = publishedSnapshot.exchange(next);
+        if (previous) {
+            retiredSnapshots.push_back(std::make_pair(previous, audioEpoch.load()));
         }
+        reclaimRetiredSnapshots();
+    }
 
-        // Find the two points to interpolate between
-        for (size_t i = 0; i < envelope.size() - 1; i++) {
-            if (phase >= envelope[i].time && phase <= envelope[i + 1].time) {
-                float t = (phase - envelope[i].time) / (envelope[i + 1].time - envelope[i].time);
-                return envelope[i].y + t * (envelope[i + 1].y - envelope[i].y);
+    // Frees snapshots no process() call can still be reading
+    void reclaimRetiredSnapshots() {
+        uint64_t epoch = audioEpoch.load();
+        retiredSnapshots.erase(std::remove_if(retiredSnapshots.begin(), retiredSnapshots.end(),
+            [epoch](const std::pair<EnvelopeSnapshot*, uint64_t>& retired) {
+                if (epoch > retired.second) {
+                    delete retired.first;
+                    return true;
+                }
+                return false;
+            }), retiredSnapshots.end());
+    }
+
+    void requestEdit(PendingEdit edit) {
+        pendingEdits.fetch_or(edit);
+    }
+
+    // UI thread: fire every voice on the next process(). Publish any envelope
+    // change first so that call already plays it.
+    void requestTriggerAll() {
+        triggerAllRequested.store(true);
+    }
+
+    // UI thread (module widget step): applies edits requested by process()
+    void applyPendingEdits() {
+        int edits = pendingEdits.exchange(0);
+        if (edits & EDIT_STOP_RECORDING) {
+            stopRecording();
+        }
+        if ((edits & EDIT_REGENERATE_ADSR) && mode == EnvelopeMode::ADSR) {
+            generateADSREnvelope();
+        }
+        if (edits & EDIT_TRIM_LEAD) {
+            if (!trimGestureLeadingSilence()) {
+                updateLastTouched("", "NO TRIM");
             }
         }
-
-        // Return last point if phase is beyond envelope
-        return envelope.back().y;
+        if (edits & EDIT_TRIM_TAIL) {
+            if (!trimGestureTrailingSilence()) {
+                updateLastTouched("", "NO TRIM");
+            }
+        }
+        if (!retiredSnapshots.empty()) {
+            reclaimRetiredSnapshots();
+        }
     }
     
     bool hasRecordedEnvelope() const {
@@ -1885,6 +2032,7 @@ struct Evocation : Module {
 
         bufferHasData = true;
         recordedDuration = totalTime;
+        publishEnvelope();
     }
 
     static int wrapIndex(int current, int delta, int maxCount) {
@@ -1998,6 +2146,7 @@ struct Evocation : Module {
             envelope.clear();
             recordedDuration = 2.0f;
         }
+        publishEnvelope();
         onEnvelopeSelectionChanged(false);
         for (int i = 0; i < NUM_ENVELOPES; i++) {
             for (int c = 0; c < MAX_POLY_CHANNELS; c++) {
@@ -2399,6 +2548,7 @@ struct Evocation : Module {
             phaseSmoothers[i].reset(phaseOffsets[i]);
         }
 
+        publishEnvelope();
         onEnvelopeSelectionChanged(false);
     }
 
@@ -2554,7 +2704,7 @@ void TouchStripWidget::onButton(const event::Button& e) {
             if (!module->bufferHasData) {
                 module->generateADSREnvelope();
             }
-            module->triggerAllEnvelopes();
+            module->requestTriggerAll();
             applyADSRTouch(true);
             e.consume(this);
         }
@@ -3756,6 +3906,15 @@ struct EvocationWidget : ModuleWidget {
         addOutput(createOutputCentered<ShapetakerBNCPort>(centerPx("env4-gate", 92.286018f, 102.08106f), module, Evocation::ENV_4_GATE_OUTPUT));
     }
 
+    void step() override {
+        // Envelope edits requested by the audio thread are applied (and
+        // republished) here, so process() never allocates or frees
+        if (auto* evocation = dynamic_cast<Evocation*>(module)) {
+            evocation->applyPendingEdits();
+        }
+        ModuleWidget::step();
+    }
+
     void appendContextMenu(Menu* menu) override {
         ModuleWidget::appendContextMenu(menu);
         auto* evocation = dynamic_cast<Evocation*>(module);
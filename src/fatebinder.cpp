@@ -229,6 +229,7 @@ struct Envelope {
         }
 
         // Calculate envelope value
+        const shapetaker::dsp::PowTable& powTable = shapetaker::dsp::PowTable::shared();
         float env = 0.f;
         float attackPhase = attack / totalTime;
 
@@ -236,17 +237,17 @@ struct Envelope {
             float t = phase / attackPhase;
             // Apply curve
             if (curve < 0.f) {
-                t = std::pow(t, 1.f + std::fabs(curve) * 2.f); // Exponential
+                t = powTable.lookup(t, 1.f + std::fabs(curve) * 2.f); // Exponential
             } else if (curve > 0.f) {
-                t = 1.f - std::pow(1.f - t, 1.f + curve * 2.f); // Logarithmic
+                t = 1.f - powTable.lookup(1.f - t, 1.f + curve * 2.f); // Logarithmic
             }
             env = t;
         } else {
             float t = (phase - attackPhase) / (1.f - attackPhase);
             if (curve < 0.f) {
-                t = 1.f - std::pow(1.f - t, 1.f + std::fabs(curve) * 2.f);
+                t = 1.f - powTable.lookup(1.f - t, 1.f + std::fabs(curve) * 2.f);
             } else if (curve > 0.f) {
-                t = std::pow(t, 1.f + curve * 2.f);
+                t = powTable.lookup(t, 1.f + curve * 2.f);
             }
             env = 1.f - t;
         }
@@ -274,71 +275,6 @@ struct Envelope {
     }
 };
 
-// ============================================================================
-// PARTICLE SYSTEM
-// ============================================================================
-
-struct Particle {
-    float x = 0.f;
-    float y = 0.f;
-    float vx = 0.f;
-    float vy = 0.f;
-    float life = 0.f;      // 0 to 1
-    float fadeRate = 1.f;
-    float brightness = 1.f;
-    int stepIndex = 0;
-    int ringIndex = 0;     // 0=orange, 1=amber, 2=red
-
-    void spawn(int step, int totalSteps, float chaos, int ring) {
-        // Position on circular display
-        float angle = (float)step / (float)totalSteps * 2.f * M_PI - M_PI * 0.5f;
-        float radius = 0.6f + (rack::random::uniform() - 0.5f) * chaos * 0.2f;
-
-        x = std::cos(angle) * radius;
-        y = std::sin(angle) * radius;
-
-        // Initial velocity (outward from center)
-        float speed = 0.3f + rack::random::uniform() * 0.2f;
-        vx = std::cos(angle) * speed;
-        vy = std::sin(angle) * speed;
-
-        life = 1.f;
-        fadeRate = 0.8f + rack::random::uniform() * 0.4f;
-        brightness = 1.f;
-        stepIndex = step;
-        ringIndex = ring;
-    }
-
-    void update(float dt, float chaos) {
-        // Physics
-        float drag = 0.95f - chaos * 0.2f;
-        vx *= drag;
-        vy *= drag;
-
-        // Slight gravity toward center (creates spiral effect)
-        float centerPull = 0.1f + chaos * 0.3f;
-        vx -= x * centerPull * dt;
-        vy -= y * centerPull * dt;
-
-        // Chaos creates turbulence
-        if (chaos > kSmallValueEpsilon) {
-            vx += (rack::random::uniform() - 0.5f) * chaos * 0.5f * dt;
-            vy += (rack::random::uniform() - 0.5f) * chaos * 0.5f * dt;
-        }
-
-        x += vx * dt;
-        y += vy * dt;
-
-        // Fade out
-        life -= fadeRate * dt;
-        brightness = rack::math::clamp(life, 0.f, 1.f);
-    }
-
-    bool isDead() const {
-        return life <= 0.f;
-    }
-};
-
 } // namespace
 
 // ============================================================================
@@ -414,9 +350,6 @@ struct Fatebinder : Module {
     static constexpr int kMaxEnvelopes = 24; // More envelopes for 3 rings
     std::vector<Envelope> envelopes;
 
-    // Particle system
-    std::vector<Particle> particles;
-
     // Timing
     float internalClock = 0.f;
     float internalClockFreq = 2.f; // 2 Hz default
@@ -481,7 +414,6 @@ struct Fatebinder : Module {
         configOutput(ACCENT_OUTPUT, "Accent");
 
         envelopes.resize(kMaxEnvelopes);
-        particles.reserve(256);
 
         onReset();
 
@@ -521,7 +453,6 @@ struct Fatebinder : Module {
         for (auto& env : envelopes) {
             env.active = false;
         }
-        particles.clear();
     }
 
     void process(const ProcessArgs& args) override {
@@ -680,18 +611,6 @@ struct Fatebinder : Module {
 
         mainCV = rack::math::clamp(mainCV, 0.f, 1.f);
 
-        // Update particles
-        for (auto& p : particles) {
-            p.update(dt, chaos);
-        }
-
-        // Remove dead particles
-        particles.erase(
-            std::remove_if(particles.begin(), particles.end(),
-                [](const Particle& p) { return p.isDead(); }),
-            particles.end()
-        );
-
         // Outputs
         float mainOut = mainCV;
         // Check bipolar state (context menu setting)
@@ -745,14 +664,6 @@ struct Fatebinder : Module {
                 env->trigger(attack, decay, curve, shape, chaos, ring);
                 anyGate = true;
                 anyAccent = anyAccent || isPatternHit;
-
-                // Spawn particles
-                int particleCount = 2 + (int)(chaos * 4);
-                for (int i = 0; i < particleCount; i++) {
-                    Particle p;
-                    p.spawn(currentStep[ring], steps, chaos, ring);
-                    particles.push_back(p);
-                }
             }
         }
     }
@@ -90,16 +90,12 @@ struct Incantation : Module {
         200.0f, 300.0f, 450.0f, 675.0f, 1000.0f, 1500.0f, 2200.0f, 3400.0f
     };
 
-    // Resonant filter implementation
+    // Resonant filter coefficient design (RBJ lowpass / constant-peak bandpass)
     struct ResonantFilter {
-        float x1 = 0.f, x2 = 0.f;
-        float y1 = 0.f, y2 = 0.f;
         float a0 = 1.f, a1 = 0.f, a2 = 0.f;
         float b1 = 0.f, b2 = 0.f;
-        bool isLowpass = false;
         
         void setLowpass(float freq, float resonance, float sampleRate) {
-            isLowpass = true;
             // Clamp to safe range — above 45% Nyquist the biquad becomes unstable
             freq = clamp(freq, 20.f, sampleRate * 0.45f);
             float omega = 2.f * M_PI * freq / sampleRate;
@@ -116,7 +112,6 @@ struct Incantation : Module {
         }
 
         void setBandpass(float freq, float resonance, float sampleRate) {
-            isLowpass = false;
             // Clamp to safe range — above 45% Nyquist the biquad becomes unstable
             freq = clamp(freq, 20.f, sampleRate * 0.45f);
             float omega = 2.f * M_PI * freq / sampleRate;
@@ -131,21 +126,25 @@ struct Incantation : Module {
             b1 = (-2.f * cos_omega) * norm;
             b2 = (1.f - alpha) * norm;
         }
+    };
+
+    // The 8 bands run as two groups of four biquads, one band per SIMD lane.
+    // Coefficients are shared by all voices; each voice keeps its own state.
+    static constexpr int NUM_BANDS = 8;
+    static constexpr int BAND_GROUPS = NUM_BANDS / 4;
+    // Modulated coefficients are redesigned every N samples and ramped linearly
+    // in between (a convex blend of stable biquads stays stable)
+    static constexpr int COEF_UPDATE_INTERVAL = 16;
+
+    struct BandCoefficients {
+        simd::float_4 a0 = 0.f, a1 = 0.f, a2 = 0.f;
+        simd::float_4 b1 = 0.f, b2 = 0.f;
+    };
+
+    struct BandState {
+        simd::float_4 x1 = 0.f, x2 = 0.f;
+        simd::float_4 y1 = 0.f, y2 = 0.f;
 
-        float process(float input) {
-            float output = a0 * input + a1 * x1 + a2 * x2 - b1 * y1 - b2 * y2;
-            // Recover from any instability that slips through
-            if (!std::isfinite(output)) {
-                reset();
-                return 0.f;
-            }
-            x2 = x1;
-            x1 = input;
-            y2 = y1;
-            y1 = output;
-            return output;
-        }
-        
         void reset() {
             x1 = x2 = y1 = y2 = 0.f;
         }
@@ -216,9 +215,12 @@ struct Incantation : Module {
         float phase = 0.f;
         float freq = 1.f;
         
-        float process(float sampleTime) {
+        void advance(float sampleTime) {
             phase += freq * sampleTime;
             if (phase >= 1.f) phase -= 1.f;
+        }
+
+        float getValue() const {
             return std::sin(phase * 2.f * M_PI);
         }
         
@@ -231,7 +233,15 @@ struct Incantation : Module {
     static const int MAX_POLY_VOICES = 6;
 
     // 8 resonant filters per voice
-    ResonantFilter filters[MAX_POLY_VOICES][8];
+    BandCoefficients bandCoefs[BAND_GROUPS];
+    BandCoefficients bandCoefSteps[BAND_GROUPS];
+    BandCoefficients bandCoefTargets[BAND_GROUPS];
+    BandState bandStates[MAX_POLY_VOICES][BAND_GROUPS];
+    int coefUpdateCounter = 0;
+    // The bank is only redesigned when freqScale or the sample rate moves
+    float designedFreqScale = 1.f;
+    float designedSampleRate = 0.f;
+    bool coefRamping = false;
     FilterEnvelope envelopes[MAX_POLY_VOICES][8];
     LFO lfo;
 
@@ -248,6 +258,7 @@ struct Incantation : Module {
     
     // State variables
     bool bassVoicing = true; // true = BASS, false = MIDS
+    bool highQ = false;
     bool lfoOn = false;
     bool bankBLFO = false;
     bool currentPatternIsStatic = true;
@@ -255,6 +266,7 @@ struct Incantation : Module {
     int currentPattern = 1; // 0-11 (Pattern 1-12)
     float animationPhase = 0.f;
     float animationRate = 1.f;
+    shapetaker::dsp::ControlRateTicker lightTicker;
     int currentStep = 0;
     float stepPhase = 0.f; // Phase within current step
     
@@ -263,6 +275,8 @@ struct Incantation : Module {
     // Updated once per sample (on voice 0) with a ~2ms time constant,
     // which passes LFO sweeps (<~80 Hz) while blocking audio-rate signals.
     float sweepCVSmooth = 0.f;
+    float sweepSmoothCoeff = 0.f;
+    float sweepSmoothSampleTime = 0.f;
 
     // For tap tempo
     float tapTimes[3] = {0.f, 0.f, 0.f};
@@ -335,45 +349,141 @@ struct Incantation : Module {
     void updateFilterVoicing() {
         float sampleRate = APP->engine->getSampleRate();
         bassVoicing = (params[FREQ_SWITCH_PARAM].getValue() < 0.5f);
-        bool highQ = (params[Q_FACTOR_SWITCH_PARAM].getValue() > 0.5f);
-        
+        highQ = (params[Q_FACTOR_SWITCH_PARAM].getValue() > 0.5f);
+
+        // Voicing changes apply immediately; modulation ramps resume on the next update
+        designFilterBank(1.f, sampleRate, bandCoefs);
+        for (int g = 0; g < BAND_GROUPS; g++) {
+            bandCoefTargets[g] = bandCoefs[g];
+            bandCoefSteps[g] = BandCoefficients();
+        }
+        designedFreqScale = 1.f;
+        designedSampleRate = sampleRate;
+        coefRamping = false;
+        coefUpdateCounter = 0;
+    }
+
+    // Computes coefficients for all 8 bands with every frequency scaled by freqScale
+    void designFilterBank(float freqScale, float sampleRate, BandCoefficients* out) const {
         // Determine Q factors based on switch
         float lowpassQ = highQ ? 1.5f : 0.9f;     // High Q: more resonant lowpass
         float bandpassQ = highQ ? 4.5f : 2.5f;    // High Q: very resonant bandpass
-        
-        // Update all voices
-        for (int v = 0; v < MAX_POLY_VOICES; v++) {
-            for (int i = 0; i < 8; i++) {
-                if (bassVoicing) {
-                    if (i == 0) {
-                        // First filter is lowpass in BASS mode
-                        filters[v][i].setLowpass(BASS_FREQS[i], lowpassQ, sampleRate);
-                    } else {
-                        // Bandpass filters with variable resonance
-                        filters[v][i].setBandpass(BASS_FREQS[i], bandpassQ, sampleRate);
-                    }
+
+        for (int i = 0; i < NUM_BANDS; i++) {
+            ResonantFilter design;
+            if (bassVoicing) {
+                if (i == 0) {
+                    // First filter is lowpass in BASS mode
+                    design.setLowpass(BASS_FREQS[i] * freqScale, lowpassQ, sampleRate);
                 } else {
-                    // All filters are bandpass in MIDS mode with variable Q
-                    filters[v][i].setBandpass(MIDS_FREQS[i], bandpassQ, sampleRate);
+                    // Bandpass filters with variable resonance
+                    design.setBandpass(BASS_FREQS[i] * freqScale, bandpassQ, sampleRate);
                 }
+            } else {
+                // All filters are bandpass in MIDS mode with variable Q
+                design.setBandpass(MIDS_FREQS[i] * freqScale, bandpassQ, sampleRate);
             }
+            BandCoefficients& group = out[i / 4];
+            int lane = i % 4;
+            group.a0[lane] = design.a0;
+            group.a1[lane] = design.a1;
+            group.a2[lane] = design.a2;
+            group.b1[lane] = design.b1;
+            group.b2[lane] = design.b2;
+        }
+    }
+
+    // Advances the LFO/sweep once per sample and ramps the shared bank coefficients.
+    // A static sweep (LFO off, CV unpatched or still) costs no redesign or ramp.
+    //   LFO OFF: CV directly shifts the whole filter bank up/down in frequency
+    //            (expression-pedal sweep mode; ±5 V gives ±2 octaves)
+    //   LFO ON:  CV modulates the LFO rate (exponential, 0.08 Hz–20 Hz range)
+    void updateFilterBankModulation(const ProcessArgs& args) {
+        bool sweepCVConnected = inputs[LFO_SWEEP_CV_INPUT].isConnected();
+        float sweepCV = sweepCVConnected ? inputs[LFO_SWEEP_CV_INPUT].getVoltage() : 0.f;
+
+        if (lfoOn) {
+            lfo.advance(args.sampleTime);
+        } else if (sweepCVConnected) {
+            // Smooth the CV with a ~2ms time constant so that audio-rate signals
+            // can't modulate IIR coefficients fast enough to cause instability.
+            if (args.sampleTime != sweepSmoothSampleTime) {
+                sweepSmoothSampleTime = args.sampleTime;
+                sweepSmoothCoeff = 1.f - std::exp(-args.sampleTime / 0.002f);
+            }
+            sweepCVSmooth += (sweepCV - sweepCVSmooth) * sweepSmoothCoeff;
+        }
+
+        if (coefUpdateCounter <= 0) {
+            coefUpdateCounter = COEF_UPDATE_INTERVAL;
+
+            float freqScale = 1.f;
+            if (lfoOn) {
+                // CV shifts LFO rate exponentially: 0 V → base rate, ±5 V → ×/÷ ~5.7
+                float lfoFreq = 0.5f;
+                if (sweepCVConnected) {
+                    lfoFreq = lfoFreq * std::pow(2.0f, sweepCV * 0.5f);
+                }
+                lfo.setFreq(clamp(lfoFreq, 0.08f, 20.f));
+                // Sweep the filter bank with the LFO (±30% frequency range)
+                freqScale = 1.f + lfo.getValue() * 0.3f;
+            } else if (sweepCVConnected) {
+                // ±5 V = ±2 octaves (V/oct-style, half-scale so expression pedals feel natural)
+                freqScale = std::pow(2.0f, sweepCVSmooth * 0.4f);
+            }
+
+            if (freqScale != designedFreqScale || args.sampleRate != designedSampleRate) {
+                designedFreqScale = freqScale;
+                designedSampleRate = args.sampleRate;
+                designFilterBank(freqScale, args.sampleRate, bandCoefTargets);
+                const float rampScale = 1.f / COEF_UPDATE_INTERVAL;
+                for (int g = 0; g < BAND_GROUPS; g++) {
+                    const BandCoefficients& target = bandCoefTargets[g];
+                    bandCoefSteps[g].a0 = (target.a0 - bandCoefs[g].a0) * rampScale;
+                    bandCoefSteps[g].a1 = (target.a1 - bandCoefs[g].a1) * rampScale;
+                    bandCoefSteps[g].a2 = (target.a2 - bandCoefs[g].a2) * rampScale;
+                    bandCoefSteps[g].b1 = (target.b1 - bandCoefs[g].b1) * rampScale;
+                    bandCoefSteps[g].b2 = (target.b2 - bandCoefs[g].b2) * rampScale;
+                }
+                coefRamping = true;
+            } else if (coefRamping) {
+                // Last ramp is done and nothing moved: land exactly on the
+                // targets and hold them
+                for (int g = 0; g < BAND_GROUPS; g++) {
+                    bandCoefs[g] = bandCoefTargets[g];
+                }
+                coefRamping = false;
+            }
+        }
+        coefUpdateCounter--;
+
+        if (!coefRamping) {
+            return;
+        }
+        for (int g = 0; g < BAND_GROUPS; g++) {
+            bandCoefs[g].a0 += bandCoefSteps[g].a0;
+            bandCoefs[g].a1 += bandCoefSteps[g].a1;
+            bandCoefs[g].a2 += bandCoefSteps[g].a2;
+            bandCoefs[g].b1 += bandCoefSteps[g].b1;
+            bandCoefs[g].b2 += bandCoefSteps[g].b2;
         }
     }
 
     void process(const ProcessArgs& args) override {
         // Update voicing if changed
         bool newBassVoicing = (params[FREQ_SWITCH_PARAM].getValue() < 0.5f);
-        static bool lastHighQ = false;
         bool currentHighQ = (params[Q_FACTOR_SWITCH_PARAM].getValue() > 0.5f);
         
-        if (newBassVoicing != bassVoicing || currentHighQ != lastHighQ) {
+        if (newBassVoicing != bassVoicing || currentHighQ != highQ) {
             updateFilterVoicing();
-            lastHighQ = currentHighQ;
         }
         
         // Update LFO state
         lfoOn = (params[LFO_SWITCH_PARAM].getValue() > 0.5f);
         bankBLFO = (params[BANK_SWITCH_PARAM].getValue() > 0.5f);
+
+        // LFO/sweep and shared filter coefficients advance once per sample
+        updateFilterBankModulation(args);
         
         // Handle preset buttons - simple preset functionality
         if (params[PRESET_ZERO_PARAM].getValue() > 0.5f) {
@@ -626,100 +736,61 @@ struct Incantation : Module {
         }
         
         // Update lights
-        lights[RATE_LIGHT].setBrightness(0.5f + 0.5f * std::sin(animationPhase * 2.f * M_PI));
+        if (lightTicker.tick(args.sampleTime)) {
+            lights[RATE_LIGHT].setBrightness(0.5f + 0.5f * std::sin(animationPhase * 2.f * M_PI));
+        }
     }
     
     float processFilterBank(float input, int voice, const ProcessArgs& args) {
-        float output = 0.f;
-        
-        // LFO/Sweep CV — behaviour matches the Moog MF-105 MuRF:
-        //   LFO OFF: CV directly shifts the whole filter bank up/down in frequency
-        //            (expression-pedal sweep mode; ±5 V gives ±2 octaves)
-        //   LFO ON:  CV modulates the LFO rate (exponential, 0.08 Hz–20 Hz range)
-        float lfoModulation = 0.f;
-        float sweepMultiplier = 1.f; // multiplicative frequency shift when LFO is off
-
-        bool sweepCVConnected = inputs[LFO_SWEEP_CV_INPUT].isConnected();
-        float sweepCV = sweepCVConnected ? inputs[LFO_SWEEP_CV_INPUT].getVoltage() : 0.f;
-
-        if (lfoOn) {
-            // CV shifts LFO rate exponentially: 0 V → base rate, ±5 V → ×/÷ ~5.7
-            float lfoFreq = 0.5f;
-            if (sweepCVConnected) {
-                lfoFreq = lfoFreq * std::pow(2.0f, sweepCV * 0.5f);
-            }
-            lfo.setFreq(clamp(lfoFreq, 0.08f, 20.f));
-            lfoModulation = lfo.process(args.sampleTime);
-
-            // Sweep the filter bank with the LFO (±30% frequency range)
-            float sampleRate = APP->engine->getSampleRate();
-            bool highQ = (params[Q_FACTOR_SWITCH_PARAM].getValue() > 0.5f);
-            float lowpassQ = highQ ? 1.5f : 0.9f;
-            float bandpassQ = highQ ? 4.5f : 2.5f;
-            for (int i = 0; i < 8; i++) {
-                float baseFreq = bassVoicing ? BASS_FREQS[i] : MIDS_FREQS[i];
-                float modulatedFreq = baseFreq * (1.f + lfoModulation * 0.3f);
-                if (bassVoicing && i == 0) {
-                    filters[voice][i].setLowpass(modulatedFreq, lowpassQ, sampleRate);
-                } else {
-                    filters[voice][i].setBandpass(modulatedFreq, bandpassQ, sampleRate);
-                }
-            }
-        } else if (sweepCVConnected) {
-            // LFO off — CV directly shifts all filter frequencies as a group.
-            // ±5 V = ±2 octaves (V/oct-style, half-scale so expression pedals feel natural).
-            // Smooth the CV once per sample (voice == 0) with a ~2ms time constant so that
-            // audio-rate signals can't modulate IIR coefficients fast enough to cause instability.
-            if (voice == 0) {
-                float smoothCoeff = 1.f - std::exp(-args.sampleTime / 0.002f);
-                sweepCVSmooth += (sweepCV - sweepCVSmooth) * smoothCoeff;
-            }
-            sweepMultiplier = std::pow(2.0f, sweepCVSmooth * 0.4f);
-
-            float sampleRate = APP->engine->getSampleRate();
-            bool highQ = (params[Q_FACTOR_SWITCH_PARAM].getValue() > 0.5f);
-            float lowpassQ = highQ ? 1.5f : 0.9f;
-            float bandpassQ = highQ ? 4.5f : 2.5f;
-            for (int i = 0; i < 8; i++) {
-                float baseFreq = (bassVoicing ? BASS_FREQS[i] : MIDS_FREQS[i]) * sweepMultiplier;
-                if (bassVoicing && i == 0) {
-                    filters[voice][i].setLowpass(baseFreq, lowpassQ, sampleRate);
-                } else {
-                    filters[voice][i].setBandpass(baseFreq, bandpassQ, sampleRate);
-                }
-            }
-        }
-        
-        // Process each filter with MuRF-style envelope control for this voice
-        for (int i = 0; i < 8; i++) {
+        // Per-band gains: slider + CV, gated by the pattern envelope
+        simd::float_4 gains[BAND_GROUPS];
+        bool cvBypass = (params[CV_BYPASS_SWITCH_PARAM].getValue() > 0.5f);
+        for (int i = 0; i < NUM_BANDS; i++) {
             // Base filter gain from slider
             float filterGain = params[FILTER_1_PARAM + i].getValue();
             
             // Add CV modulation for this filter (if not bypassed)
-            bool cvBypass = (params[CV_BYPASS_SWITCH_PARAM].getValue() > 0.5f);
             if (inputs[FILTER_1_CV_INPUT + i].isConnected() && !cvBypass) {
                 float cv = inputs[FILTER_1_CV_INPUT + i].getPolyVoltage(voice);
                 float cvModulation = cv / 5.f; // ±5V = ±1.0 modulation
                 filterGain = clamp(filterGain + cvModulation, 0.f, 1.f);
             }
             
+            float gain = 0.f;
             if (filterGain > 0.001f) {
-                // Apply filter for this voice
-                float filtered = filters[voice][i].process(input);
-                
-                // Apply envelope modulation based on pattern
                 if (currentPatternIsStatic) {
                     // No-animation patterns: no envelope modulation, just slider values + CV
-                    output += filtered * filterGain;
+                    gain = filterGain;
                 } else {
-                    // Other patterns: Use envelope to gate the filter
-                    float envelope = envelopes[voice][i].process(args.sampleTime);
-                    
                     // In MuRF style, the envelope acts as a gate/VCA for each filter
                     // The slider + CV sets the maximum level, the envelope controls when it's active
-                    output += filtered * filterGain * envelope;
+                    gain = filterGain * envelopes[voice][i].process(args.sampleTime);
                 }
             }
+            gains[i / 4][i % 4] = gain;
+        }
+
+        // Two 4-wide biquad groups cover all 8 bands for this voice
+        simd::float_4 mixed = 0.f;
+        simd::float_4 x = input;
+        for (int g = 0; g < BAND_GROUPS; g++) {
+            const BandCoefficients& c = bandCoefs[g];
+            BandState& state = bandStates[voice][g];
+            simd::float_4 y = c.a0 * x + c.a1 * state.x1 + c.a2 * state.x2 - c.b1 * state.y1 - c.b2 * state.y2;
+            state.x2 = state.x1;
+            state.x1 = x;
+            state.y2 = state.y1;
+            state.y1 = y;
+            mixed += y * gains[g];
+        }
+
+        float output = mixed[0] + mixed[1] + mixed[2] + mixed[3];
+        // Recover from any instability that slips through
+        if (!std::isfinite(output)) {
+            for (int g = 0; g < BAND_GROUPS; g++) {
+                bandStates[voice][g].reset();
+            }
+            return 0.f;
         }
         
         return output * 1.2f; // Higher output for musical resonant filters
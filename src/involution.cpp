@@ -52,9 +52,16 @@ struct Involution : Module {
         LIGHTS_LEN
     };
 
-    // Per-voice 6th-order filters
+    // Per-voice 6th-order filters: scalar reference...
     shapetaker::dsp::VoiceArray<LiquidFilter> filtersA;
     shapetaker::dsp::VoiceArray<LiquidFilter> filtersB;
+    // ...and the SIMD engine, lanes {A, B} of voice 2g and {A, B} of voice 2g+1
+    static constexpr int FILTER_GROUPS = shapetaker::PolyphonicProcessor::MAX_VOICES / 2;
+    std::array<LiquidFilter4, FILTER_GROUPS> filterGroups;
+    bool simdFilters = true;        // context menu: SIMD or scalar reference
+    bool lastSimdFilters = true;
+    bool sleepWhenSilent = true;    // context menu: skip the DSP once input and tail are silent
+    shapetaker::dsp::SilenceSleep silence;
 
     // Per-voice frequency shifters — A shifts up, B shifts down (counter-rotating stereo)
     std::array<shapetaker::involution::FrequencyShifter,
@@ -116,6 +123,7 @@ struct Involution : Module {
     static constexpr float PHASER_MAX_FEEDBACK = 0.65f;   // max APF feedback (sharpens notches)
     static constexpr float PHASER_LEVEL_COMP   = 1.414f;  // ~+3dB makeup for notch-induced level loss
     static constexpr float FREQ_SHIFT_MAX_HZ   = 100.f;  // absolute ceiling for shift depth knob
+    static constexpr float SLEEP_TAIL_SECONDS  = 0.1f;   // two periods of the lowest cutoff
 
     // Bidirectional linking state
     float lastCutoffA = -1.f, lastCutoffB = -1.f;
@@ -132,6 +140,8 @@ struct Involution : Module {
     float modAmount    = 0.f;
     float shimmerAmount = 0.f;
 
+    shapetaker::dsp::ControlRateTicker lightTicker;
+
     // Screen color theme (0=Phosphor, 1=Ice, 2=Solar, 3=Amber)
     int chaosTheme = 0;
 
@@ -182,12 +192,18 @@ struct Involution : Module {
     json_t* dataToJson() override {
         json_t* rootJ = json_object();
         json_object_set_new(rootJ, "chaosTheme", json_integer(chaosTheme));
+        json_object_set_new(rootJ, "simdFilters", json_boolean(simdFilters));
+        json_object_set_new(rootJ, "sleepWhenSilent", json_boolean(sleepWhenSilent));
         return rootJ;
     }
 
     void dataFromJson(json_t* rootJ) override {
         json_t* j = json_object_get(rootJ, "chaosTheme");
         if (j) chaosTheme = clamp((int)json_integer_value(j), 0, 3);
+        json_t* simdJ = json_object_get(rootJ, "simdFilters");
+        if (simdJ) simdFilters = json_boolean_value(simdJ);
+        json_t* sleepJ = json_object_get(rootJ, "sleepWhenSilent");
+        if (sleepJ) sleepWhenSilent = json_boolean_value(sleepJ);
     }
 
     void onSampleRateChange() override {
@@ -198,6 +214,11 @@ struct Involution : Module {
         for (int v = 0; v < shapetaker::PolyphonicProcessor::MAX_VOICES; v++) {
             filtersA[v].setSampleRate(sr);
             filtersB[v].setSampleRate(sr);
+            freqShiftersA[v].setSampleRate(sr);
+            freqShiftersB[v].setSampleRate(sr);
+        }
+        for (LiquidFilter4& group : filterGroups) {
+            group.setSampleRate(sr);
         }
     }
 
@@ -253,6 +274,9 @@ struct Involution : Module {
             phasersA[v].reset();
             phasersB[v].reset();
         }
+        for (LiquidFilter4& group : filterGroups) {
+            group.reset();
+        }
         onSampleRateChange();
     }
 
@@ -369,13 +393,44 @@ struct Involution : Module {
         int channels  = std::min(std::max(channelsA, channelsB),
                                  shapetaker::PolyphonicProcessor::MAX_VOICES);
 
+        float inputPeak = std::max(shapetaker::dsp::portPeak(inputs[AUDIO_A_INPUT]),
+                                   shapetaker::dsp::portPeak(inputs[AUDIO_B_INPUT]));
+        silence.setEnabled(sleepWhenSilent);
+        silence.setTailSeconds(SLEEP_TAIL_SECONDS);
+
         if (!hasAudioA && !hasAudioB) {
             outputs[AUDIO_A_OUTPUT].setChannels(0);
             outputs[AUDIO_B_OUTPUT].setChannels(0);
+        } else if (silence.asleep(inputPeak)) {
+            // Filters, shifters and phasers hold their state until input returns
+            outputs[AUDIO_A_OUTPUT].setChannels(channels);
+            outputs[AUDIO_B_OUTPUT].setChannels(channels);
+            for (int c = 0; c < channels; c++) {
+                outputs[AUDIO_A_OUTPUT].setVoltage(0.f, c);
+                outputs[AUDIO_B_OUTPUT].setVoltage(0.f, c);
+            }
         } else {
             outputs[AUDIO_A_OUTPUT].setChannels(channels);
             outputs[AUDIO_B_OUTPUT].setChannels(channels);
 
+            // Switching engines resumes from silence rather than stale state
+            if (simdFilters != lastSimdFilters) {
+                for (LiquidFilter4& group : filterGroups) {
+                    group.reset();
+                }
+                for (int v = 0; v < shapetaker::PolyphonicProcessor::MAX_VOICES; v++) {
+                    filtersA[v].reset();
+                    filtersB[v].reset();
+                }
+                lastSimdFilters = simdFilters;
+            }
+
+            // Gathered per voice so the filters can run as one SIMD pass
+            float filterIn[2][shapetaker::PolyphonicProcessor::MAX_VOICES] = {};
+            float filterOut[2][shapetaker::PolyphonicProcessor::MAX_VOICES] = {};
+            float filterHz[2][shapetaker::PolyphonicProcessor::MAX_VOICES] = {};
+            float filterRes[2][shapetaker::PolyphonicProcessor::MAX_VOICES] = {};
+
             for (int c = 0; c < channels; c++) {
                 // --- Input ---
                 float audioA = 0.f, audioB = 0.f;
@@ -428,16 +483,48 @@ struct Involution : Module {
                 float cutoffAHz = CUTOFF_HZ_BASE * std::pow(2.f, shapedA * CUTOFF_HZ_OCTAVES);
                 float cutoffBHz = CUTOFF_HZ_BASE * std::pow(2.f, shapedB * CUTOFF_HZ_OCTAVES);
 
-                float processedA = filtersA[c].process(audioA, cutoffAHz, voiceResA, 1.0f);
-                float processedB = filtersB[c].process(audioB, cutoffBHz, voiceResB, 1.0f);
+                filterIn[0][c]  = audioA;
+                filterIn[1][c]  = audioB;
+                filterHz[0][c]  = cutoffAHz;
+                filterHz[1][c]  = cutoffBHz;
+                filterRes[0][c] = voiceResA;
+                filterRes[1][c] = voiceResB;
+            }
+
+            if (simdFilters) {
+                // Lanes {A, B} of voice 2g and {A, B} of voice 2g+1
+                for (int g = 0; g < (channels + 1) / 2; g++) {
+                    int c0 = 2 * g;
+                    int c1 = 2 * g + 1;
+                    float_4 out = filterGroups[g].process(
+                        float_4(filterIn[0][c0], filterIn[1][c0], filterIn[0][c1], filterIn[1][c1]),
+                        float_4(filterHz[0][c0], filterHz[1][c0], filterHz[0][c1], filterHz[1][c1]),
+                        float_4(filterRes[0][c0], filterRes[1][c0], filterRes[0][c1], filterRes[1][c1]),
+                        1.0f);
+                    filterOut[0][c0] = out[0];
+                    filterOut[1][c0] = out[1];
+                    filterOut[0][c1] = out[2];
+                    filterOut[1][c1] = out[3];
+                }
+            } else {
+                for (int c = 0; c < channels; c++) {
+                    filterOut[0][c] = filtersA[c].process(filterIn[0][c], filterHz[0][c], filterRes[0][c], 1.0f);
+                    filterOut[1][c] = filtersB[c].process(filterIn[1][c], filterHz[1][c], filterRes[1][c], 1.0f);
+                }
+            }
+
+            float outputPeak = 0.f;
+            for (int c = 0; c < channels; c++) {
+                float processedA = filterOut[0][c];
+                float processedB = filterOut[1][c];
 
                 // --- Stereo frequency shifter (post-filter, pre-phaser) ---
                 // A shifts up, B shifts down — spectral content counter-rotates across
                 // the stereo field. Slow beating at low amounts; inharmonic shimmer at high.
                 if (crossAmount > EFFECT_THRESHOLD) {
                     float shiftHz  = crossAmount * shiftDepth;
-                    float shiftedA = freqShiftersA[c].process(processedA,  shiftHz, args.sampleRate);
-                    float shiftedB = freqShiftersB[c].process(processedB, -shiftHz, args.sampleRate);
+                    float shiftedA = freqShiftersA[c].process(processedA,  shiftHz);
+                    float shiftedB = freqShiftersB[c].process(processedB, -shiftHz);
                     processedA = rack::math::crossfade(processedA, shiftedA, crossAmount);
                     processedB = rack::math::crossfade(processedB, shiftedB, crossAmount);
                 }
@@ -468,12 +555,17 @@ struct Involution : Module {
 
                 outputs[AUDIO_A_OUTPUT].setVoltage(processedA, c);
                 outputs[AUDIO_B_OUTPUT].setVoltage(processedB, c);
+                outputPeak = std::max(outputPeak, std::max(std::fabs(processedA), std::fabs(processedB)));
             }
+            silence.observe(std::max(inputPeak, outputPeak), args.sampleTime);
         }
 
         // ====================================================================
         // LIGHTS — Cross=Red, Mod=Green, Shimmer=Blue
         // ====================================================================
+        if (!lightTicker.tick(args.sampleTime)) {
+            return;
+        }
         lights[CHAOS_LIGHT].setBrightness(clamp(crossAmount, 0.f, 1.f));
         lights[CHAOS_LIGHT_GREEN].setBrightness(clamp(modAmount, 0.f, 1.f));
         lights[CHAOS_LIGHT_BLUE].setBrightness(clamp(shimmerAmount, 0.f, 1.f));
@@ -825,6 +917,20 @@ struct InvolutionWidget : ModuleWidget {
                         [=] { inv->chaosTheme = i; }));
                 }
             }));
+        menu->addChild(createSubmenuItem(
+            "Filter engine",
+            inv->simdFilters ? "SIMD" : "Scalar (reference)",
+            [=](Menu* childMenu) {
+                childMenu->addChild(createCheckMenuItem("SIMD", "",
+                    [=] { return inv->simdFilters; },
+                    [=] { inv->simdFilters = true; }));
+                childMenu->addChild(createCheckMenuItem("Scalar (reference)", "",
+                    [=] { return !inv->simdFilters; },
+                    [=] { inv->simdFilters = false; }));
+            }));
+        menu->addChild(createCheckMenuItem("Sleep when silent", "",
+            [=] { return inv->sleepWhenSilent; },
+            [=] { inv->sleepWhenSilent = !inv->sleepWhenSilent; }));
     }
 };
 
@@ -107,17 +107,51 @@ public:
  * beating at low amounts and dramatic inharmonic textures at higher settings.
  *
  * The Hilbert pair uses two 4-stage first-order allpass chains whose combined
- * phase response differs by ~90° from ~30 Hz to ~18 kHz (< 2° error across
- * the audio band at 44.1/48 kHz).  The allpass transfer function is:
- *   H(z) = (a - z^-1) / (1 - a·z^-1)
- * which gives unity gain at all frequencies, only shifting phase.
+ * phase response differs by ~90° from 30 Hz to 18 kHz.  Each stage is
+ *   H(z) = (a + z^-1) / (1 + a·z^-1)
+ * which gives unity gain at all frequencies, only shifting phase.  Pole
+ * positions depend on the sample rate, so there is one minimax-designed set
+ * per supported rate; setSampleRate() picks the nearest one.
+ *
+ * The carrier is a recursive phasor: a unit complex number rotated by a fixed
+ * step each sample and pulled back onto the unit circle with a first-order
+ * correction, so no trig runs per sample.
  */
 class FrequencyShifter {
 private:
     static constexpr int kHilbertStages = 4;
-    static constexpr float kPhaseMin = -1.f;
-    static constexpr float kPhaseMax = 1.f;
     static constexpr float kPhaseRadians = 2.f * static_cast<float>(M_PI);
+    // Above this step the truncated series below loses accuracy
+    static constexpr float kMaxSeriesStep = 0.5f;
+
+    struct HilbertCoefficients {
+        float sampleRate;
+        float maxErrorDegrees;  // worst quadrature error, 30 Hz – 18 kHz
+        float ci[kHilbertStages];
+        float cq[kHilbertStages];
+    };
+
+    static const HilbertCoefficients& coefficientsFor(float sampleRate) {
+        static const HilbertCoefficients kSets[] = {
+            { 44100.f, 2.7f, {-0.989431f, -0.907071f, -0.395999f,  0.706130f},
+                             {-0.997539f, -0.967841f, -0.746905f,  0.144358f}},
+            { 48000.f, 2.3f, {-0.990753f, -0.922583f, -0.496227f,  0.622661f},
+                             {-0.997808f, -0.972564f, -0.791818f,  0.005602f}},
+            { 96000.f, 1.7f, {-0.995889f, -0.969250f, -0.796633f,  0.127303f},
+                             {-0.998986f, -0.988494f, -0.919496f, -0.517315f}},
+            {192000.f, 1.6f, {-0.997983f, -0.985135f, -0.899277f, -0.254263f},
+                             {-0.999499f, -0.994402f, -0.961019f, -0.742964f}},
+        };
+        const int count = sizeof(kSets) / sizeof(kSets[0]);
+        int best = 0;
+        for (int i = 1; i < count; i++) {
+            if (std::fabs(std::log(sampleRate / kSets[i].sampleRate)) <
+                std::fabs(std::log(sampleRate / kSets[best].sampleRate))) {
+                best = i;
+            }
+        }
+        return kSets[best];
+    }
 
     struct Allpass1 {
         float x1 = 0.f, y1 = 0.f;
@@ -131,31 +165,59 @@ private:
 
     Allpass1 stagesI[kHilbertStages];
     Allpass1 stagesQ[kHilbertStages];
-    float phase = 0.f;
+    const HilbertCoefficients* coefficients = &coefficientsFor(48000.f);
+    float sampleRate = 48000.f;
+
+    // Carrier phasor and its per-sample rotation
+    float phasorCos = 1.f;
+    float phasorSin = 0.f;
+    float stepCos = 1.f;
+    float stepSin = 0.f;
+    float stepShiftHz = 0.f;
+
+    void updateStep(float shiftHz) {
+        stepShiftHz = shiftHz;
+        float theta = kPhaseRadians * shiftHz / sampleRate;
+        if (std::fabs(theta) > kMaxSeriesStep) {
+            stepCos = std::cos(theta);
+            stepSin = std::sin(theta);
+            return;
+        }
+        // Taylor series; the shift knob keeps theta well under 0.1 rad
+        float t2 = theta * theta;
+        stepCos = 1.f - t2 * (1.f / 2.f - t2 * (1.f / 24.f - t2 * (1.f / 720.f)));
+        stepSin = theta * (1.f - t2 * (1.f / 6.f - t2 * (1.f / 120.f - t2 * (1.f / 5040.f))));
+    }
 
 public:
-    // shiftHz > 0 shifts spectrum up; shiftHz < 0 shifts down
-    float process(float input, float shiftHz, float sampleRate) {
-        // 4-pair IIR Hilbert approximation coefficients
-        // Tuned for <2° quadrature error from ~30 Hz to ~18 kHz
-        static const float CI[kHilbertStages] = {0.0721f, 0.3699f, 0.6899f, 0.9150f};
-        static const float CQ[kHilbertStages] = {0.2040f, 0.5200f, 0.8192f, 0.9720f};
+    void setSampleRate(float sr) {
+        sampleRate = sr;
+        coefficients = &coefficientsFor(sr);
+        updateStep(stepShiftHz);
+    }
 
+    // shiftHz > 0 shifts spectrum up; shiftHz < 0 shifts down
+    float process(float input, float shiftHz) {
         float I = input;
         float Q = input;
         for (int i = 0; i < kHilbertStages; i++) {
-            I = stagesI[i].process(I, CI[i]);
-            Q = stagesQ[i].process(Q, CQ[i]);
+            I = stagesI[i].process(I, coefficients->ci[i]);
+            Q = stagesQ[i].process(Q, coefficients->cq[i]);
         }
 
-        phase += shiftHz / sampleRate;
-        if (phase >  kPhaseMax) phase -= kPhaseMax;
-        if (phase < kPhaseMin) phase += kPhaseMax;
-
         // Upper sideband: I·cos(φ) - Q·sin(φ)
-        float cosP = std::cos(kPhaseRadians * phase);
-        float sinP = std::sin(kPhaseRadians * phase);
-        return I * cosP - Q * sinP;
+        float output = I * phasorCos - Q * phasorSin;
+
+        if (shiftHz != stepShiftHz) {
+            updateStep(shiftHz);
+        }
+        float c = phasorCos * stepCos - phasorSin * stepSin;
+        float s = phasorCos * stepSin + phasorSin * stepCos;
+        // One Newton step towards |phasor| = 1; rounding drift stays at float epsilon
+        float gain = 1.5f - 0.5f * (c * c + s * s);
+        phasorCos = c * gain;
+        phasorSin = s * gain;
+        return output;
     }
 
     void reset() {
@@ -163,7 +225,8 @@ public:
             stagesI[i].reset();
             stagesQ[i].reset();
         }
-        phase = 0.f;
+        phasorCos = 1.f;
+        phasorSin = 0.f;
     }
 };
 
@@ -76,6 +76,8 @@ struct NocturneTV : Module {
     float uiClockSeconds = 0.f;
     std::array<float, 4> signalRawFollow = {0.f, 0.f, 0.f, 0.f};
     std::array<float, 4> signalEnvFollow = {0.f, 0.f, 0.f, 0.f};
+    std::array<float, 4> fallbackSignals = {0.f, 0.f, 0.f, 0.f};
+    shapetaker::dsp::ControlRateTicker telemetryTicker;
 
     NocturneTV() {
         config(PARAMS_LEN, INPUTS_LEN, OUTPUTS_LEN, LIGHTS_LEN);
@@ -126,6 +128,59 @@ struct NocturneTV : Module {
     }
 
     void process(const ProcessArgs& args) override {
+        uiClockSeconds += args.sampleTime;
+        if (uiClockSeconds > 100000.f) {
+            uiClockSeconds = 0.f;
+        }
+
+        // Fallback motion and everything published to the screen run at
+        // control rate; only the signal followers see every sample.
+        bool telemetryTick = telemetryTicker.tick(args.sampleTime);
+        if (telemetryTick) {
+            float drift = clamp(params[DRIFT_PARAM].getValue() + inputs[DRIFT_CV_INPUT].getVoltage() * 0.2f, 0.f, 1.f);
+            int sceneIndex = clamp(static_cast<int>(std::round(params[CHANNEL_PARAM].getValue())), 0, SCENE_STEP_COUNT - 1);
+            float sceneNorm = static_cast<float>(sceneIndex) / static_cast<float>(SCENE_STEP_COUNT - 1);
+            demoPhase += telemetryTicker.getElapsed() * (0.075f + drift * 0.20f + sceneNorm * 0.14f);
+            if (demoPhase >= 1.f) {
+                demoPhase -= std::floor(demoPhase);
+            }
+            float phase = demoPhase * TAU;
+
+            // Internal motion keeps visuals alive when an input is unpatched.
+            fallbackSignals = {
+                std::sin(phase * 1.3f + std::sin(phase * 0.21f) * 0.7f) * 4.0f,
+                std::cos(phase * 1.8f + 0.9f) * 3.5f,
+                std::sin(phase * 0.9f + std::cos(phase * 0.17f) * 1.4f) * 3.7f,
+                std::cos(phase * 2.2f + std::sin(phase * 0.41f) * 1.0f) * 3.9f
+            };
+        }
+
+        float inputGain = clamp(params[INPUT_GAIN_PARAM].getValue(), INPUT_GAIN_MIN, INPUT_GAIN_MAX);
+        float peak = 0.f;
+
+        float rawSlew = clamp(args.sampleTime * 42.f, 0.f, 1.f);
+        float envAttack = clamp(args.sampleTime * 32.f, 0.f, 1.f);
+        float envRelease = clamp(args.sampleTime * 9.f, 0.f, 1.f);
+
+        for (int i = 0; i < 4; ++i) {
+            float rawSignal = readInputAverage(inputs[SIGNAL_1_INPUT + i], fallbackSignals[i]) * inputGain;
+            float rawNorm = clamp(rawSignal / 8.f, -1.f, 1.f);
+            signalRawFollow[i] += (rawNorm - signalRawFollow[i]) * rawSlew;
+
+            float envTarget = std::fabs(rawNorm);
+            float coeff = envTarget > signalEnvFollow[i] ? envAttack : envRelease;
+            signalEnvFollow[i] += (envTarget - signalEnvFollow[i]) * coeff;
+
+            peak = std::max(peak, std::fabs(rawSignal));
+        }
+
+        float level = clamp(peak / 8.f, 0.f, 1.f);
+        signalMeter += (level - signalMeter) * 0.020f;
+
+        if (!telemetryTick) {
+            return;
+        }
+
         float warp = clamp(params[WARP_PARAM].getValue() + inputs[WARP_CV_INPUT].getVoltage() * 0.2f, 0.f, 1.f);
         float noise = clamp(params[NOISE_PARAM].getValue() + inputs[NOISE_CV_INPUT].getVoltage() * 0.2f, 0.f, 1.f);
         float tear = clamp(params[TEAR_PARAM].getValue() + inputs[TEAR_CV_INPUT].getVoltage() * 0.2f, 0.f, 1.f);
@@ -144,7 +199,6 @@ struct NocturneTV : Module {
         if (inputs[FILL_CV_INPUT].isConnected()) {
             fill = clamp(inputs[FILL_CV_INPUT].getVoltage() / 10.f, 0.f, 1.f);
         }
-        float inputGain = clamp(params[INPUT_GAIN_PARAM].getValue(), INPUT_GAIN_MIN, INPUT_GAIN_MAX);
         float refreshHz = clamp(params[REFRESH_PARAM].getValue(), REFRESH_MIN_HZ, REFRESH_MAX_HZ);
         int sceneIndex = clamp(static_cast<int>(std::round(params[CHANNEL_PARAM].getValue())), 0, SCENE_STEP_COUNT - 1);
         int mode = clamp(static_cast<int>(std::round(params[MODE_PARAM].getValue())), 0, 3);
@@ -157,51 +211,11 @@ struct NocturneTV : Module {
             (inputs[SIGNAL_3_INPUT].isConnected() ? 0x4 : 0) |
             (inputs[SIGNAL_4_INPUT].isConnected() ? 0x8 : 0);
 
-        uiClockSeconds += args.sampleTime;
-        if (uiClockSeconds > 100000.f) {
-            uiClockSeconds = 0.f;
-        }
-
-        float sceneNorm = static_cast<float>(sceneIndex) / static_cast<float>(SCENE_STEP_COUNT - 1);
-        demoPhase += args.sampleTime * (0.075f + drift * 0.20f + sceneNorm * 0.14f);
-        if (demoPhase >= 1.f) {
-            demoPhase -= std::floor(demoPhase);
-        }
-        float phase = demoPhase * TAU;
-
-        // Internal motion keeps visuals alive when an input is unpatched.
-        std::array<float, 4> fallback = {
-            std::sin(phase * 1.3f + std::sin(phase * 0.21f) * 0.7f) * 4.0f,
-            std::cos(phase * 1.8f + 0.9f) * 3.5f,
-            std::sin(phase * 0.9f + std::cos(phase * 0.17f) * 1.4f) * 3.7f,
-            std::cos(phase * 2.2f + std::sin(phase * 0.41f) * 1.0f) * 3.9f
-        };
-
-        std::array<float, 4> rawSignals = {};
-        std::array<float, 4> rawNorm = {};
         float sumEnv = 0.f;
-        float peak = 0.f;
-
-        float rawSlew = clamp(args.sampleTime * 42.f, 0.f, 1.f);
-        float envAttack = clamp(args.sampleTime * 32.f, 0.f, 1.f);
-        float envRelease = clamp(args.sampleTime * 9.f, 0.f, 1.f);
-
         for (int i = 0; i < 4; ++i) {
-            rawSignals[i] = readInputAverage(inputs[SIGNAL_1_INPUT + i], fallback[i]) * inputGain;
-            rawNorm[i] = clamp(rawSignals[i] / 8.f, -1.f, 1.f);
-            signalRawFollow[i] += (rawNorm[i] - signalRawFollow[i]) * rawSlew;
-
-            float envTarget = std::fabs(rawNorm[i]);
-            float coeff = envTarget > signalEnvFollow[i] ? envAttack : envRelease;
-            signalEnvFollow[i] += (envTarget - signalEnvFollow[i]) * coeff;
-
             sumEnv += signalEnvFollow[i];
-            peak = std::max(peak, std::fabs(rawSignals[i]));
         }
-
         float avgEnv = sumEnv * 0.25f;
-        float level = clamp(peak / 8.f, 0.f, 1.f);
-        signalMeter += (level - signalMeter) * 0.020f;
 
         // Route all signal buses into a synthetic CRT/video processor model:
         // S1 = horizontal deflection, S2 = vertical hold, S3 = key/contrast, S4 = chroma/feedback injection.
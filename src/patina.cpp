@@ -1,6 +1,7 @@
 #include "plugin.hpp"
 #include "dsp/polyphony.hpp"
 #include "utilities.hpp"
+#include "ui/menu_helpers.hpp"
 #include <algorithm>
 #include <array>
 #include <string>
@@ -72,6 +73,9 @@ struct PatinaLFOCore {
     // Random waveform sample-and-hold state
     float randomSH = 0.f;
 
+    // Eco/precise transcendentals, copied from the module before each process()
+    shapetaker::dsp::MathMode math;
+
     enum Shape {
         SINE = 0,
         TRIANGLE,
@@ -187,7 +191,7 @@ struct PatinaLFOCore {
         auto generateShape = [&](int s) -> float {
             switch (s) {
                 case 0: // SINE
-                    return std::sin(2.f * M_PI * phase);
+                    return math.sin2pi(phase);
                 case 1: // TRIANGLE
                     return 4.f * std::abs(phase - 0.5f) - 1.f;
                 case 2: // SAW
@@ -200,7 +204,7 @@ struct PatinaLFOCore {
                     }
                     return randomSH;
                 default:
-                    return std::sin(2.f * M_PI * phase);
+                    return math.sin2pi(phase);
             }
         };
 
@@ -211,8 +215,8 @@ struct PatinaLFOCore {
             float shape1 = generateShape(shapeFloor);
             float shape2 = generateShape(rack::math::clamp(shapeFloor + 1, 0, 4));
             // Equal-power crossfade: cos/sin curves maintain constant energy
-            float angle = shapeFrac * 0.5f * M_PI;
-            rawOutput = shape1 * std::cos(angle) + shape2 * std::sin(angle);
+            float fadePhase = shapeFrac * 0.25f;
+            rawOutput = shape1 * math.cos2pi(fadePhase) + shape2 * math.sin2pi(fadePhase);
         }
 
         // ====================================================================
@@ -221,7 +225,7 @@ struct PatinaLFOCore {
         if (complexity > 0.01f) {
             // Add octave down
             float subPhase = phase * 0.5f;
-            float subharmonic = std::sin(2.f * M_PI * subPhase) * 0.3f;
+            float subharmonic = math.sin2pi(subPhase) * 0.3f;
 
             // Add noise
             float noise = getNextNoise() * 0.2f;
@@ -373,6 +377,9 @@ struct Patina : Module {
     // Envelope smoothing to prevent pops
     float slewedEnvelope = 0.f;
 
+    // LFO lights run at control rate
+    shapetaker::dsp::ControlRateTicker lightTicker;
+
     // Harmonic lock mode state
     bool harmonicLockEnabled = false;
 
@@ -381,6 +388,8 @@ struct Patina : Module {
     int envelopeMode = 0;          // 0=Frequency, 1=Amplitude
     bool bipolarEnvelope = false;  // Bipolar envelope conversion
     bool lfoClockModes[3] = {false, false, false}; // false = free, true = clock subdivisions
+    shapetaker::dsp::MathModeSetting mathSetting;  // Eco (fastmath) or precise (libm) LFO shapes and rates
+    shapetaker::dsp::MathMode math;                // what process() runs with
 
     float getClockSubdivision(float rateControl) const {
         float normalized = rack::math::clamp(rateControl, -6.f, 3.f);
@@ -461,6 +470,8 @@ struct Patina : Module {
     }
 
     void process(const ProcessArgs& args) override {
+        mathSetting.apply(math);
+
         // ====================================================================
         // RESET HANDLING
         // ====================================================================
@@ -615,7 +626,7 @@ struct Patina : Module {
             // Combine master rate, per-core rate, and CV
             // Shift everything down ~1.5 octaves so the master/rate knobs reach slower zones.
             constexpr float rangeShiftOctaves = 1.5f;
-            float frequency = std::pow(2.f, masterRate + rateControl - rangeShiftOctaves);
+            float frequency = math.exp2(masterRate + rateControl - rangeShiftOctaves);
             frequency = rack::math::clamp(frequency, 0.005f, args.sampleRate / 2.f);
 
             // Optionally override with external clock subdivisions per LFO
@@ -683,6 +694,7 @@ struct Patina : Module {
         // PROCESS 3 LFO CORES
         // ====================================================================
         float lfoOutputs[3] = {0.f, 0.f, 0.f};
+        bool lightTick = lightTicker.tick(args.sampleTime);
 
         for (int i = 0; i < 3; ++i) {
             if (!outputs[LFO_1_OUTPUT + i].isConnected()) {
@@ -696,6 +708,7 @@ struct Patina : Module {
 
             // Process LFO with global drift and jitter
             // Use slewed envelope to prevent pops from rapid envelope changes
+            lfoCores[i].math = math;
             float lfoOut = lfoCores[i].process(
                 frequency,
                 args.sampleRate,
@@ -728,6 +741,9 @@ struct Patina : Module {
             // LFO 2: Purple (#b400ff) = R:0.7, G:0, B:1
             // LFO 3: Amber (#ffb400) = R:1, G:0.7, B:0
             float brightness = std::abs(lfoOut) / 5.f;
+            if (!lightTick) {
+                continue;
+            }
             if (i == 0) {
                 // Teal
                 lights[LFO_1_LIGHT + 0].setBrightness(0.f);
@@ -760,7 +776,7 @@ struct Patina : Module {
 
                 // Convert phase to stereo position using sine/cosine
                 // This creates a smooth circular panning motion
-                float pan = std::sin(2.f * M_PI * phase); // -1 (left) to +1 (right)
+                float pan = math.sin2pi(phase); // -1 (left) to +1 (right)
 
                 // Equal-power panning law
                 float panRight = (pan + 1.f) * 0.5f; // 0 to 1
@@ -811,6 +827,7 @@ struct Patina : Module {
             json_array_append_new(clockModesJ, json_boolean(lfoClockModes[i]));
         }
         json_object_set_new(rootJ, "lfoClockModes", clockModesJ);
+        mathSetting.dataToJson(rootJ);
 
         return rootJ;
     }
@@ -857,6 +874,8 @@ struct Patina : Module {
                 }
             }
         }
+
+        mathSetting.dataFromJson(rootJ);
     }
 };
 
@@ -1153,6 +1172,13 @@ struct PatinaWidget : ModuleWidget {
         BipolarEnvelopeItem* bipolarEnvItem = createMenuItem<BipolarEnvelopeItem>("Bipolar Envelope (-1 to +1)");
         bipolarEnvItem->module = module;
         menu->addChild(bipolarEnvItem);
+
+        menu->addChild(new MenuSeparator);
+
+        // ====================================================================
+        // Math
+        // ====================================================================
+        menu->addChild(shapetaker::ui::createPreciseMathItem(&module->mathSetting));
     }
 };
 
@@ -5,6 +5,9 @@ Plugin* pluginInstance;
 void init(Plugin* p) {
     pluginInstance = p;
 
+    // Build shared lookup tables here rather than on first use in an audio thread
+    shapetaker::dsp::PowTable::shared();
+
     p->addModel(modelClairaudient);
     p->addModel(modelChiaroscuro);
     p->addModel(modelFatebinder);
@@ -2,6 +2,10 @@
 #include "reverie/dattorro_plate.hpp"
 #include "reverie/reverb_modes.hpp"
 
+#include <algorithm>
+#include <atomic>
+#include <vector>
+
 struct Reverie : Module {
     enum ParamIds {
         MODE_PARAM,
@@ -49,10 +53,69 @@ struct Reverie : Module {
         MODULATED = 4
     };
 
+    static constexpr int MAX_VOICES = shapetaker::PolyphonicProcessor::MAX_VOICES;
+    // Vectorized path: four voices per DattorroPlate4
+    static constexpr int PLATE_GROUPS = (MAX_VOICES + 3) / 4;
+    // Channels sharing one plate in POLY_GROUPED
+    static constexpr int GROUP_SIZE = 2;
+    // Unused voices keep their tails this long before their memory is freed
+    static constexpr double VOICE_RELEASE_SECONDS = 10.0;
+    // Quiet wet signal must last this long before the plates sleep: longer
+    // than the tank's loop and a reverse grain held for playback (<= 0.5 s)
+    static constexpr float SLEEP_TAIL_SECONDS = 1.5f;
+
+    // How poly channels map onto plates. Shared plates run on the summed
+    // input of their channels, trading stereo separation for CPU.
+    enum PolyMode {
+        POLY_PER_VOICE = 0,
+        POLY_GROUPED,      // one plate per GROUP_SIZE channels, wet split across them
+        POLY_SUMMED,       // one plate, wet split across every channel
+        POLY_SUMMED_FIRST, // one plate, wet on channel 1 only
+        POLY_MODE_COUNT
+    };
+
+    using DattorroPlate = shapetaker::reverie::DattorroPlate;
+    using DattorroPlate4 = shapetaker::reverie::DattorroPlate4;
+    using ReverbModeProcessor = shapetaker::reverie::ReverbModeProcessor;
+
     // DSP
     shapetaker::PolyphonicProcessor polyProcessor;
-    shapetaker::VoiceArray<shapetaker::reverie::DattorroPlate> plates;
-    shapetaker::VoiceArray<shapetaker::reverie::ReverbModeProcessor> modeProcessors;
+
+    // Plates and mode processors are built lazily for the plate count and
+    // mode process() reports, on the UI thread (serviceVoices), and handed
+    // over through these pointers. A null plate renders dry; a processor for
+    // another mode falls back to the clean plate until its replacement lands.
+    // Only one kind of plate is built: plateGroups when simdPlates is on,
+    // per-voice plates otherwise.
+    std::atomic<DattorroPlate*> plates[MAX_VOICES];
+    std::atomic<DattorroPlate4*> plateGroups[PLATE_GROUPS];
+    std::atomic<ReverbModeProcessor*> modeProcessors[MAX_VOICES];
+    // Context menu: run four voices per plate; the per-voice plates are kept as the reference
+    std::atomic<bool> simdPlates{true};
+    // Context menu: PolyMode
+    std::atomic<int> polyMode{POLY_PER_VOICE};
+    // Context menu: four-grain pitch shifters in Field Blur and Afterimage
+    std::atomic<bool> fourGrainShifters{false};
+    // Context menu: stop running the plates once input and tails are silent
+    std::atomic<bool> sleepWhenSilent{true};
+    shapetaker::dsp::SilenceSleep silence;
+    std::atomic<int> requestedPlates{1};
+    std::atomic<int> requestedMode{0};
+    std::atomic<float> voiceSampleRate{44100.0f};
+    // Bumped at the start of every plate block; retired voices are freed
+    // once it has moved past their retirement value
+    std::atomic<uint64_t> audioEpoch{0};
+
+    // UI thread only
+    struct RetiredVoice {
+        DattorroPlate* plate;
+        ReverbModeProcessor* modes;
+        DattorroPlate4* plateGroup;
+        uint64_t epoch;
+    };
+    std::vector<RetiredVoice> retiredVoices;
+    double voiceLastUsed[MAX_VOICES] = {};
+    double groupLastUsed[PLATE_GROUPS] = {};
 
     // Parameter smoothing
     float smoothedDecay = 0.5f;
@@ -62,6 +125,31 @@ struct Reverie : Module {
     float smoothedParam2 = 0.5f;
     float smoothedBlend = 1.0f;
     float smoothAlpha = 0.001f;
+    shapetaker::dsp::ControlRateTicker ledTicker;
+
+    // Block processing. The plates render a block of output ahead (their
+    // shortest input-to-output path is far longer than a block), the mode
+    // processors run per sample against it, and the plates take the block's
+    // input once it is complete, so there is no added latency. Pointers,
+    // strategy and mode are held from the start of a block to its end.
+    static constexpr int PLATE_BLOCK = shapetaker::reverie::PLATE_MAX_BLOCK;
+    int blockPos = 0;
+    int blockLength = 0;
+    int blockPlates = 0;
+    int blockStrategy = POLY_PER_VOICE;
+    int blockMode = 0;
+    bool blockSimd = false;
+    DattorroPlate* blockPlate[MAX_VOICES] = {};
+    DattorroPlate4* blockGroup[PLATE_GROUPS] = {};
+    ReverbModeProcessor* blockModes[MAX_VOICES] = {};
+    bool blockLive[MAX_VOICES] = {};
+    float blockTankStartL[MAX_VOICES] = {}, blockTankStartR[MAX_VOICES] = {};
+    float blockOutL[MAX_VOICES][PLATE_BLOCK], blockOutR[MAX_VOICES][PLATE_BLOCK];
+    float blockTankL[MAX_VOICES][PLATE_BLOCK], blockTankR[MAX_VOICES][PLATE_BLOCK];
+    float blockInL[MAX_VOICES][PLATE_BLOCK], blockInR[MAX_VOICES][PLATE_BLOCK];
+    // Latest drive per plate; damping applies from the next block render,
+    // depth and LFO rate when the block is written
+    shapetaker::reverie::PlateDrive slotDrive[MAX_VOICES];
 
     // DC blocking state
     shapetaker::FloatVoices dcBlockLastInL, dcBlockLastOutL;
@@ -96,22 +184,108 @@ struct Reverie : Module {
         shapetaker::ParameterHelper::configAudioOutput(this, AUDIO_L_OUTPUT, "L");
         shapetaker::ParameterHelper::configAudioOutput(this, AUDIO_R_OUTPUT, "R");
 
+        for (int ch = 0; ch < MAX_VOICES; ch++) {
+            plates[ch].store(nullptr);
+            modeProcessors[ch].store(nullptr);
+        }
+        for (int g = 0; g < PLATE_GROUPS; g++) {
+            plateGroups[g].store(nullptr);
+        }
+
         currentSampleRate = APP->engine->getSampleRate();
         updateSampleRate();
 
         shapetaker::ui::LabelFormatter::normalizeModuleControls(this);
     }
 
+    ~Reverie() override {
+        for (int ch = 0; ch < MAX_VOICES; ch++) {
+            delete plates[ch].exchange(nullptr);
+            delete modeProcessors[ch].exchange(nullptr);
+        }
+        for (int g = 0; g < PLATE_GROUPS; g++) {
+            delete plateGroups[g].exchange(nullptr);
+        }
+        for (const RetiredVoice& retired : retiredVoices) {
+            delete retired.plate;
+            delete retired.modes;
+            delete retired.plateGroup;
+        }
+    }
+
     void updateSampleRate() {
-        plates.forEach([this](shapetaker::reverie::DattorroPlate& plate) {
-            plate.setSampleRate(currentSampleRate);
-        });
-        modeProcessors.forEach([this](shapetaker::reverie::ReverbModeProcessor& mp) {
-            mp.setSampleRate(currentSampleRate);
-        });
+        // Voices built for another rate are rebuilt by serviceVoices()
+        voiceSampleRate.store(currentSampleRate);
         smoothAlpha = 1.0f - std::exp(-2.0f * (float)M_PI * 30.0f / currentSampleRate);
     }
 
+    void retireVoice(DattorroPlate* plate, ReverbModeProcessor* modes, DattorroPlate4* plateGroup = nullptr) {
+        if (plate || modes || plateGroup) {
+            retiredVoices.push_back({plate, modes, plateGroup, audioEpoch.load()});
+        }
+    }
+
+    // UI thread (module widget step, or process() when headless): builds,
+    // swaps and frees voices. Never runs concurrently with itself.
+    void serviceVoices() {
+        float sampleRate = voiceSampleRate.load();
+        int plateCount = requestedPlates.load();
+        int mode = requestedMode.load();
+        bool simd = simdPlates.load();
+        int grains = fourGrainShifters.load() ? 4 : 2;
+        double now = system::getTime();
+
+        for (int g = 0; g < PLATE_GROUPS; g++) {
+            DattorroPlate4* group = plateGroups[g].load();
+            if (simd && g * 4 < plateCount) {
+                groupLastUsed[g] = now;
+                if (!group || group->getSampleRate() != sampleRate) {
+                    DattorroPlate4* fresh = new DattorroPlate4;
+                    fresh->setSampleRate(sampleRate);
+                    retireVoice(nullptr, nullptr, plateGroups[g].exchange(fresh));
+                }
+            } else if (group && (!simd || now - groupLastUsed[g] > VOICE_RELEASE_SECONDS)) {
+                retireVoice(nullptr, nullptr, plateGroups[g].exchange(nullptr));
+            }
+        }
+
+        for (int ch = 0; ch < MAX_VOICES; ch++) {
+            DattorroPlate* plate = plates[ch].load();
+            ReverbModeProcessor* modes = modeProcessors[ch].load();
+
+            if (ch < plateCount) {
+                voiceLastUsed[ch] = now;
+                if (simd) {
+                    retireVoice(plates[ch].exchange(nullptr), nullptr);
+                } else if (!plate || plate->getSampleRate() != sampleRate) {
+                    DattorroPlate* fresh = new DattorroPlate;
+                    fresh->setSampleRate(sampleRate);
+                    retireVoice(plates[ch].exchange(fresh), nullptr);
+                }
+                if (!modes || modes->getPreparedMode() != mode || modes->getSampleRate() != sampleRate
+                    || modes->getShifterGrains() != grains) {
+                    ReverbModeProcessor* fresh = new ReverbModeProcessor;
+                    fresh->prepare(sampleRate, mode, grains);
+                    retireVoice(nullptr, modeProcessors[ch].exchange(fresh));
+                }
+            } else if ((plate || modes) && now - voiceLastUsed[ch] > VOICE_RELEASE_SECONDS) {
+                retireVoice(plates[ch].exchange(nullptr), modeProcessors[ch].exchange(nullptr));
+            }
+        }
+
+        uint64_t epoch = audioEpoch.load();
+        retiredVoices.erase(std::remove_if(retiredVoices.begin(), retiredVoices.end(),
+            [epoch](const RetiredVoice& retired) {
+                if (epoch > retired.epoch) {
+                    delete retired.plate;
+                    delete retired.modes;
+                    delete retired.plateGroup;
+                    return true;
+                }
+                return false;
+            }), retiredVoices.end());
+    }
+
     void onSampleRateChange() override {
         currentSampleRate = APP->engine->getSampleRate();
         updateSampleRate();
@@ -148,6 +322,17 @@ struct Reverie : Module {
         int mode = rack::math::clamp((int)std::round(params[MODE_PARAM].getValue()), 0, 4);
         currentMode = mode;
 
+        // Read once so a menu change can't remap channels mid-sample
+        const int strategy = polyMode.load(std::memory_order_relaxed);
+        const int plateCount = getPlateCount(strategy, channels);
+
+        // Tell the allocator what we need; headless hosts have no UI thread
+        requestedPlates.store(plateCount, std::memory_order_relaxed);
+        requestedMode.store(mode, std::memory_order_relaxed);
+        if (settings::headless) {
+            serviceVoices();
+        }
+
         // Read and smooth parameters
         float targetDecay = readParam(DECAY_PARAM, DECAY_CV_INPUT, DECAY_ATT_PARAM);
         float targetMix = readParam(MIX_PARAM, MIX_CV_INPUT, MIX_ATT_PARAM);
@@ -168,58 +353,303 @@ struct Reverie : Module {
         float damping = 1.0f - smoothedTone; // tone 0 = dark (high damping), tone 1 = bright (low damping)
 
         // Update mode LED
-        float ledR, ledG, ledB;
-        getModeColor(mode, ledR, ledG, ledB);
-        lights[MODE_LED_R].setBrightness(ledR);
-        lights[MODE_LED_G].setBrightness(ledG);
-        lights[MODE_LED_B].setBrightness(ledB);
+        if (ledTicker.tick(args.sampleTime)) {
+            float ledR, ledG, ledB;
+            getModeColor(mode, ledR, ledG, ledB);
+            lights[MODE_LED_R].setBrightness(ledR);
+            lights[MODE_LED_G].setBrightness(ledG);
+            lights[MODE_LED_B].setBrightness(ledB);
+        }
+
+        // Blend scales P1/P2: at blend=0 both are 0 (clean plate),
+        // at blend=1 they're at full value. Single signal path, no clicks.
+        float blendedP1 = smoothedParam1 * smoothedBlend;
+        float blendedP2 = smoothedParam2 * smoothedBlend;
+
+        // Sleep only starts or ends between plate blocks
+        float inputPeak = std::max(shapetaker::dsp::portPeak(inputs[AUDIO_L_INPUT]),
+                                   shapetaker::dsp::portPeak(inputs[AUDIO_R_INPUT]));
+        silence.setEnabled(sleepWhenSilent.load(std::memory_order_relaxed));
+        silence.setTailSeconds(SLEEP_TAIL_SECONDS);
+        if (blockPos == 0 && silence.asleep(inputPeak)) {
+            // No plate is held between blocks, so retired voices can still be freed
+            audioEpoch.fetch_add(1);
+            for (int ch = 0; ch < channels; ch++) {
+                outputs[AUDIO_L_OUTPUT].setVoltage(0.0f, ch);
+                outputs[AUDIO_R_OUTPUT].setVoltage(0.0f, ch);
+            }
+            return;
+        }
 
-        // Process each voice
+        if (blockPos == 0) {
+            beginPlateBlock(strategy, plateCount, mode, decay, damping);
+        }
+
+        // Plate inputs: each channel adds into the plate its strategy assigns
+        float dspInL[MAX_VOICES], dspInR[MAX_VOICES];
+        float plateInL[MAX_VOICES] = {}, plateInR[MAX_VOICES] = {};
         for (int ch = 0; ch < channels; ch++) {
-            float inL = inputs[AUDIO_L_INPUT].getPolyVoltage(ch);
-            float inR = inputs[AUDIO_R_INPUT].isConnected()
-                ? inputs[AUDIO_R_INPUT].getPolyVoltage(ch)
-                : inL;
+            readVoiceInput(ch, dspInL[ch], dspInR[ch]);
+            int slot = getPlateSlot(blockStrategy, ch);
+            plateInL[slot] += dspInL[ch];
+            plateInR[slot] += dspInR[ch];
+        }
 
-            // Normalize to ~-1..1 for DSP
-            float dspInL = inL * 0.2f;
-            float dspInR = inR * 0.2f;
+        float plateWetL[MAX_VOICES] = {}, plateWetR[MAX_VOICES] = {};
+        float wetPeak = 0.0f;
+        for (int slot = 0; slot < blockPlates; slot++) {
+            if (blockLive[slot]) {
+                processPlateSample(slot, plateInL[slot], plateInR[slot], damping,
+                                   blendedP1, blendedP2, plateWetL[slot], plateWetR[slot]);
+                wetPeak = std::max(wetPeak, std::max(std::fabs(plateWetL[slot]), std::fabs(plateWetR[slot])));
+            }
+        }
+        // Wet is tracked before the mix so a tail behind a dry mix setting still counts
+        silence.observe(std::max(inputPeak, wetPeak * 5.0f), args.sampleTime);
 
-            float wetL = 0.0f, wetR = 0.0f;
+        // A shared plate's wet is split evenly across its channels, so the
+        // channels mixed back together sound like their own plates would
+        const int voicesPerPlate = getVoicesPerPlate(blockStrategy, channels);
+        for (int ch = 0; ch < channels; ch++) {
+            int slot = getPlateSlot(blockStrategy, ch);
+            float share = 1.0f;
+            if (blockStrategy == POLY_SUMMED_FIRST) {
+                share = (ch == 0) ? 1.0f : 0.0f;
+            } else if (voicesPerPlate > 1) {
+                int members = std::min(voicesPerPlate, channels - slot * voicesPerPlate);
+                share = 1.0f / (float)members;
+            }
+            writeVoiceOutput(ch, dspInL[ch], dspInR[ch], plateWetL[slot] * share, plateWetR[slot] * share);
+        }
 
-            // Blend scales P1/P2: at blend=0 both are 0 (clean plate),
-            // at blend=1 they're at full value. Single signal path, no clicks.
-            float blendedP1 = smoothedParam1 * smoothedBlend;
-            float blendedP2 = smoothedParam2 * smoothedBlend;
+        if (++blockPos >= blockLength) {
+            endPlateBlock();
+            blockPos = 0;
+        }
+    }
 
-            modeProcessors[ch].process(plates[ch], dspInL, dspInR,
-                                       decay, damping,
-                                       blendedP1, blendedP2,
-                                       mode, wetL, wetR);
+    static int getVoicesPerPlate(int strategy, int channels) {
+        switch (strategy) {
+            case POLY_GROUPED: return GROUP_SIZE;
+            case POLY_SUMMED:
+            case POLY_SUMMED_FIRST: return std::max(channels, 1);
+            default: return 1;
+        }
+    }
 
-            // DC block wet signal
-            wetL = shapetaker::AudioProcessor::processDCBlock(
-                wetL, dcBlockLastInL[ch], dcBlockLastOutL[ch]);
-            wetR = shapetaker::AudioProcessor::processDCBlock(
-                wetR, dcBlockLastInR[ch], dcBlockLastOutR[ch]);
+    static int getPlateCount(int strategy, int channels) {
+        int voicesPerPlate = getVoicesPerPlate(strategy, channels);
+        return (channels + voicesPerPlate - 1) / voicesPerPlate;
+    }
 
-            // Constant power wet/dry mix
-            float outL, outR;
-            shapetaker::AudioProcessor::stereoConstantPowerCrossfade(
-                dspInL, dspInR, wetL, wetR, smoothedMix, outL, outR);
+    static int getPlateSlot(int strategy, int ch) {
+        switch (strategy) {
+            case POLY_GROUPED: return ch / GROUP_SIZE;
+            case POLY_SUMMED:
+            case POLY_SUMMED_FIRST: return 0;
+            default: return ch;
+        }
+    }
 
-            // Scale back to modular level and soft limit
-            outL = shapetaker::AudioProcessor::softLimit(outL * 5.0f, 10.0f);
-            outR = shapetaker::AudioProcessor::softLimit(outR * 5.0f, 10.0f);
+    void readVoiceInput(int ch, float& dspInL, float& dspInR) {
+        float inL = inputs[AUDIO_L_INPUT].getPolyVoltage(ch);
+        float inR = inputs[AUDIO_R_INPUT].isConnected()
+            ? inputs[AUDIO_R_INPUT].getPolyVoltage(ch)
+            : inL;
 
-            outputs[AUDIO_L_OUTPUT].setVoltage(outL, ch);
-            outputs[AUDIO_R_OUTPUT].setVoltage(outR, ch);
+        // Normalize to ~-1..1 for DSP
+        dspInL = inL * 0.2f;
+        dspInR = inR * 0.2f;
+    }
+
+    // DC block, wet/dry mix and output stage for one voice
+    void writeVoiceOutput(int ch, float dspInL, float dspInR, float wetL, float wetR) {
+        // DC block wet signal
+        wetL = shapetaker::AudioProcessor::processDCBlock(
+            wetL, dcBlockLastInL[ch], dcBlockLastOutL[ch]);
+        wetR = shapetaker::AudioProcessor::processDCBlock(
+            wetR, dcBlockLastInR[ch], dcBlockLastOutR[ch]);
+
+        // Constant power wet/dry mix
+        float outL, outR;
+        shapetaker::AudioProcessor::stereoConstantPowerCrossfade(
+            dspInL, dspInR, wetL, wetR, smoothedMix, outL, outR);
+
+        // Scale back to modular level and soft limit
+        outL = shapetaker::AudioProcessor::softLimit(outL * 5.0f, 10.0f);
+        outR = shapetaker::AudioProcessor::softLimit(outR * 5.0f, 10.0f);
+
+        outputs[AUDIO_L_OUTPUT].setVoltage(outL, ch);
+        outputs[AUDIO_R_OUTPUT].setVoltage(outR, ch);
+    }
+
+    // Picks up the plates for the next block and renders its output: one
+    // scalar DattorroPlate per slot, or one DattorroPlate4 per four slots
+    void beginPlateBlock(int strategy, int plateCount, int mode, float decay, float damping) {
+        using float_4 = simd::float_4;
+
+        audioEpoch.fetch_add(1);
+        blockStrategy = strategy;
+        blockPlates = plateCount;
+        blockMode = mode;
+        blockSimd = simdPlates.load(std::memory_order_relaxed);
+        blockLength = PLATE_BLOCK;
+
+        for (int slot = 0; slot < plateCount; slot++) {
+            blockModes[slot] = modeProcessors[slot].load(std::memory_order_acquire);
+            if (blockModes[slot] && blockModes[slot]->getPreparedMode() != mode) {
+                // Replacement not built yet: clean plate
+                blockModes[slot] = nullptr;
+            }
+            if (!blockLive[slot]) {
+                slotDrive[slot] = {0.0f, 0.0f, damping, 1.0f, 0.0f};
+            }
+        }
+
+        if (blockSimd) {
+            for (int g = 0; g * 4 < plateCount; g++) {
+                blockGroup[g] = plateGroups[g].load(std::memory_order_acquire);
+                if (blockGroup[g]) {
+                    blockLength = std::min(blockLength, blockGroup[g]->getBlockLimit());
+                }
+            }
+            for (int g = 0; g * 4 < plateCount; g++) {
+                DattorroPlate4* plate = blockGroup[g];
+                const int firstSlot = g * 4;
+                const int lanes = std::min(4, plateCount - firstSlot);
+                for (int v = 0; v < lanes; v++) {
+                    blockLive[firstSlot + v] = plate != nullptr;
+                }
+                if (!plate) {
+                    // Group not built yet: dry only
+                    continue;
+                }
+
+                float_4 plateDamping = damping;
+                for (int v = 0; v < lanes; v++) {
+                    int slot = firstSlot + v;
+                    plateDamping[v] = slotDrive[slot].damping;
+                    blockTankStartL[slot] = plate->lastTankOut[0][v];
+                    blockTankStartR[slot] = plate->lastTankOut[1][v];
+                }
+
+                float_4 outL[PLATE_BLOCK], outR[PLATE_BLOCK], tankL[PLATE_BLOCK], tankR[PLATE_BLOCK];
+                plate->renderBlock(decay, plateDamping, outL, outR, tankL, tankR, blockLength);
+                for (int v = 0; v < lanes; v++) {
+                    int slot = firstSlot + v;
+                    for (int i = 0; i < blockLength; i++) {
+                        blockOutL[slot][i] = outL[i][v];
+                        blockOutR[slot][i] = outR[i][v];
+                        blockTankL[slot][i] = tankL[i][v];
+                        blockTankR[slot][i] = tankR[i][v];
+                    }
+                }
+            }
+        } else {
+            for (int slot = 0; slot < plateCount; slot++) {
+                blockPlate[slot] = plates[slot].load(std::memory_order_acquire);
+                if (blockPlate[slot]) {
+                    blockLength = std::min(blockLength, blockPlate[slot]->getBlockLimit());
+                }
+            }
+            for (int slot = 0; slot < plateCount; slot++) {
+                DattorroPlate* plate = blockPlate[slot];
+                blockLive[slot] = plate != nullptr;
+                if (!plate) {
+                    // Plate not built yet: dry only
+                    continue;
+                }
+                blockTankStartL[slot] = plate->lastTankOut[0];
+                blockTankStartR[slot] = plate->lastTankOut[1];
+                plate->renderBlock(decay, slotDrive[slot].damping, blockOutL[slot], blockOutR[slot],
+                                   blockTankL[slot], blockTankR[slot], blockLength);
+            }
+        }
+        for (int slot = plateCount; slot < MAX_VOICES; slot++) {
+            blockLive[slot] = false;
+        }
+    }
+
+    // One sample of one plate: the mode's pre stage records the plate input,
+    // its post stage shapes the already rendered plate output
+    void processPlateSample(int slot, float inL, float inR, float damping,
+                            float blendedP1, float blendedP2, float& wetL, float& wetR) {
+        const int i = blockPos;
+        ReverbModeProcessor* modes = blockModes[slot];
+
+        shapetaker::reverie::PlateDrive drive = {inL, inR, damping, 1.0f, 0.0f};
+        if (modes) {
+            float prevTankL = (i == 0) ? blockTankStartL[slot] : blockTankL[slot][i - 1];
+            float prevTankR = (i == 0) ? blockTankStartR[slot] : blockTankR[slot][i - 1];
+            modes->processPre(blockMode, inL, inR, damping, blendedP1, blendedP2,
+                              prevTankL, prevTankR, drive);
+        }
+        blockInL[slot][i] = drive.inL;
+        blockInR[slot][i] = drive.inR;
+        slotDrive[slot] = drive;
+
+        if (modes) {
+            modes->processPost(blockMode, blockOutL[slot][i], blockOutR[slot][i],
+                               blockTankL[slot][i], blockTankR[slot][i],
+                               blendedP1, blendedP2, wetL, wetR);
+        } else {
+            wetL = blockOutL[slot][i];
+            wetR = blockOutR[slot][i];
+        }
+    }
+
+    // Hands the finished block's input to the plates
+    void endPlateBlock() {
+        using float_4 = simd::float_4;
+
+        if (blockSimd) {
+            for (int g = 0; g * 4 < blockPlates; g++) {
+                DattorroPlate4* plate = blockGroup[g];
+                if (!plate) {
+                    continue;
+                }
+                const int firstSlot = g * 4;
+                const int lanes = std::min(4, blockPlates - firstSlot);
+                float_4 inL[PLATE_BLOCK], inR[PLATE_BLOCK];
+                for (int i = 0; i < blockLength; i++) {
+                    inL[i] = 0.0f;
+                    inR[i] = 0.0f;
+                }
+                for (int v = 0; v < lanes; v++) {
+                    int slot = firstSlot + v;
+                    for (int i = 0; i < blockLength; i++) {
+                        inL[i][v] = blockInL[slot][i];
+                        inR[i][v] = blockInR[slot][i];
+                    }
+                    plate->modDepthScale[v] = slotDrive[slot].modDepthScale;
+                    if (slotDrive[slot].lfoRate > 0.0f) {
+                        plate->setLFORate(v, slotDrive[slot].lfoRate);
+                    }
+                }
+                plate->writeBlock(inL, inR, blockLength);
+            }
+        } else {
+            for (int slot = 0; slot < blockPlates; slot++) {
+                DattorroPlate* plate = blockPlate[slot];
+                if (!plate) {
+                    continue;
+                }
+                plate->modDepthScale = slotDrive[slot].modDepthScale;
+                if (slotDrive[slot].lfoRate > 0.0f) {
+                    plate->setLFORate(slotDrive[slot].lfoRate);
+                }
+                plate->writeBlock(blockInL[slot], blockInR[slot], blockLength);
+            }
         }
     }
 
     json_t* dataToJson() override {
         json_t* rootJ = json_object();
         json_object_set_new(rootJ, "mode", json_integer(currentMode));
+        json_object_set_new(rootJ, "simdPlates", json_boolean(simdPlates.load()));
+        json_object_set_new(rootJ, "polyMode", json_integer(polyMode.load()));
+        json_object_set_new(rootJ, "fourGrainShifters", json_boolean(fourGrainShifters.load()));
+        json_object_set_new(rootJ, "sleepWhenSilent", json_boolean(sleepWhenSilent.load()));
         return rootJ;
     }
 
@@ -228,11 +658,34 @@ struct Reverie : Module {
         if (modeJ) {
             currentMode = json_integer_value(modeJ);
         }
+        json_t* simdPlatesJ = json_object_get(rootJ, "simdPlates");
+        if (simdPlatesJ) {
+            simdPlates.store(json_boolean_value(simdPlatesJ));
+        }
+        json_t* polyModeJ = json_object_get(rootJ, "polyMode");
+        if (polyModeJ) {
+            polyMode.store(rack::math::clamp((int)json_integer_value(polyModeJ), 0, POLY_MODE_COUNT - 1));
+        }
+        json_t* fourGrainShiftersJ = json_object_get(rootJ, "fourGrainShifters");
+        if (fourGrainShiftersJ) {
+            fourGrainShifters.store(json_boolean_value(fourGrainShiftersJ));
+        }
+        json_t* sleepWhenSilentJ = json_object_get(rootJ, "sleepWhenSilent");
+        if (sleepWhenSilentJ) {
+            sleepWhenSilent.store(json_boolean_value(sleepWhenSilentJ));
+        }
     }
 };
 
 struct ReverieWidget : ModuleWidget {
 
+    void step() override {
+        if (auto* reverie = dynamic_cast<Reverie*>(module)) {
+            reverie->serviceVoices();
+        }
+        ModuleWidget::step();
+    }
+
     void draw(const DrawArgs& args) override {
         // Leather texture background (same pattern as Chiaroscuro)
         std::shared_ptr<Image> bg = APP->window->loadImage(asset::plugin(pluginInstance, "res/panels/panel_background.png"));
@@ -313,6 +766,26 @@ struct ReverieWidget : ModuleWidget {
         std::string p2Str = std::string("Param 2: ") + p2Label;
         menu->addChild(createMenuLabel(p1Str.c_str()));
         menu->addChild(createMenuLabel(p2Str.c_str()));
+
+        menu->addChild(new MenuSeparator);
+        menu->addChild(createMenuLabel("Polyphony"));
+        static const char* const polyModeNames[Reverie::POLY_MODE_COUNT] = {
+            "Per Voice", "Grouped (2 voices per plate)", "Summed (wet on every channel)", "Summed (wet on channel 1)"
+        };
+        for (int i = 0; i < Reverie::POLY_MODE_COUNT; i++) {
+            menu->addChild(createCheckMenuItem(polyModeNames[i], "",
+                [=]{ return module->polyMode.load() == i; },
+                [=]{ module->polyMode.store(i); }));
+        }
+        menu->addChild(createCheckMenuItem("Vectorized Plates", "",
+            [=]{ return module->simdPlates.load(); },
+            [=]{ module->simdPlates.store(!module->simdPlates.load()); }));
+        menu->addChild(createCheckMenuItem("4-Grain Pitch Shifters", "",
+            [=]{ return module->fourGrainShifters.load(); },
+            [=]{ module->fourGrainShifters.store(!module->fourGrainShifters.load()); }));
+        menu->addChild(createCheckMenuItem("Sleep When Silent", "",
+            [=]{ return module->sleepWhenSilent.load(); },
+            [=]{ module->sleepWhenSilent.store(!module->sleepWhenSilent.load()); }));
     }
 
     ReverieWidget(Reverie* module) {
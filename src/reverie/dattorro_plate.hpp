@@ -1,6 +1,7 @@
 #pragma once
 
 #include <rack.hpp>
+#include <algorithm>
 #include <cmath>
 #include <cstring>
 
@@ -49,29 +50,88 @@ static const int TAP_R_FROM_D1R   = 2111;   // -  from delay1 right
 static const int TAP_R_FROM_AP2R  = 335;    // -  from AP2 right
 static const int TAP_R_FROM_D2R   = 121;    // -  from delay2 right
 
-// Max scale: support up to 192kHz
-static const int MAX_SCALE = 7;
-
-// Individual buffer max sizes
-static const int MAX_INPUT_AP1     = REF_INPUT_AP1 * MAX_SCALE + 16;
-static const int MAX_INPUT_AP2     = REF_INPUT_AP2 * MAX_SCALE + 16;
-static const int MAX_INPUT_AP3     = REF_INPUT_AP3 * MAX_SCALE + 16;
-static const int MAX_INPUT_AP4     = REF_INPUT_AP4 * MAX_SCALE + 16;
-static const int MAX_TANK_MOD_AP_L = REF_TANK_MOD_AP_L * MAX_SCALE + 64;
-static const int MAX_TANK_MOD_AP_R = REF_TANK_MOD_AP_R * MAX_SCALE + 64;
-static const int MAX_TANK_DELAY1_L = REF_TANK_DELAY1_L * MAX_SCALE + 16;
-static const int MAX_TANK_DELAY1_R = REF_TANK_DELAY1_R * MAX_SCALE + 16;
-static const int MAX_TANK_AP2_L    = REF_TANK_AP2_L * MAX_SCALE + 16;
-static const int MAX_TANK_AP2_R    = REF_TANK_AP2_R * MAX_SCALE + 16;
-static const int MAX_TANK_DELAY2_L = REF_TANK_DELAY2_L * MAX_SCALE + 16;
-static const int MAX_TANK_DELAY2_R = REF_TANK_DELAY2_R * MAX_SCALE + 16;
-
-static const int TOTAL_BUFFER_SIZE =
-    MAX_INPUT_AP1 + MAX_INPUT_AP2 + MAX_INPUT_AP3 + MAX_INPUT_AP4 +
-    MAX_TANK_MOD_AP_L + MAX_TANK_MOD_AP_R +
-    MAX_TANK_DELAY1_L + MAX_TANK_DELAY1_R +
-    MAX_TANK_AP2_L + MAX_TANK_AP2_R +
-    MAX_TANK_DELAY2_L + MAX_TANK_DELAY2_R;
+// Buffers are sized for the sample rate actually in use: scaled reference
+// length plus a little headroom. Modulated allpasses also need room for the
+// LFO excursion (8 reference samples times modDepthScale, which modes push
+// up to 8).
+static const int BUFFER_PAD = 16;
+static const float MOD_EXCURSION_REF = 64.0f;
+static const int PLATE_BUFFER_COUNT = 12;
+
+// Reference lengths in plate order: 4 input allpasses, then modAP, delay1,
+// AP2, delay2 for the left and then the right half of the tank
+static const int PLATE_REF_DELAYS[PLATE_BUFFER_COUNT] = {
+    REF_INPUT_AP1, REF_INPUT_AP2, REF_INPUT_AP3, REF_INPUT_AP4,
+    REF_TANK_MOD_AP_L, REF_TANK_DELAY1_L, REF_TANK_AP2_L, REF_TANK_DELAY2_L,
+    REF_TANK_MOD_AP_R, REF_TANK_DELAY1_R, REF_TANK_AP2_R, REF_TANK_DELAY2_R
+};
+
+// Longest block the block API runs in one pass; see plateBlockLimit()
+static const int PLATE_MAX_BLOCK = 32;
+
+inline int scalePlateDelay(int refDelay, float sampleRate) {
+    return (int)(refDelay * sampleRate / DATTORRO_REF_RATE);
+}
+
+// Buffer lengths in PLATE_REF_DELAYS order
+inline int plateBufferSizes(float sampleRate, int sizes[PLATE_BUFFER_COUNT]) {
+    int modPad = (int)std::ceil(MOD_EXCURSION_REF * sampleRate / DATTORRO_REF_RATE) + BUFFER_PAD;
+    int total = 0;
+    for (int i = 0; i < PLATE_BUFFER_COUNT; i++) {
+        bool modulated = (i == 4 || i == 8);
+        sizes[i] = scalePlateDelay(PLATE_REF_DELAYS[i], sampleRate) + (modulated ? modPad : BUFFER_PAD);
+        total += sizes[i];
+    }
+    return total;
+}
+
+// Block processing splits a plate step in two. render runs everything
+// downstream of the delay1 reads (damping, AP2, delay2, output taps) for a
+// whole block; write then pushes the block's input through the diffusers
+// and modulated allpasses into delay1. That is exact while no sample of the
+// block reaches the output within the block: every delay1 tap and both
+// tank delays must be longer than the block. Taps read after the block has
+// been written must also not have been overwritten by it. Returns the
+// longest block meeting both, capped at PLATE_MAX_BLOCK.
+inline int plateBlockLimit(float sampleRate) {
+    // {reference tap, buffer index} for all 14 output taps
+    static const int taps[14][2] = {
+        {TAP_L_FROM_D1R_A, 9}, {TAP_L_FROM_D1R_B, 9}, {TAP_L_FROM_AP2R, 10}, {TAP_L_FROM_D2R, 11},
+        {TAP_L_FROM_D1L, 5}, {TAP_L_FROM_AP2L, 6}, {TAP_L_FROM_D2L, 7},
+        {TAP_R_FROM_D1L_A, 5}, {TAP_R_FROM_D1L_B, 5}, {TAP_R_FROM_AP2L, 6}, {TAP_R_FROM_D2L, 7},
+        {TAP_R_FROM_D1R, 9}, {TAP_R_FROM_AP2R, 10}, {TAP_R_FROM_D2R, 11}
+    };
+    int sizes[PLATE_BUFFER_COUNT];
+    plateBufferSizes(sampleRate, sizes);
+
+    int limit = PLATE_MAX_BLOCK;
+    for (int i = 0; i < 14; i++) {
+        int buffer = taps[i][1];
+        int length = scalePlateDelay(PLATE_REF_DELAYS[buffer], sampleRate);
+        int tap = std::min(scalePlateDelay(taps[i][0], sampleRate), length);
+        if (buffer == 5 || buffer == 9) {
+            limit = std::min(limit, tap - 1);
+        }
+        limit = std::min(limit, sizes[buffer] - tap + 1);
+    }
+    const int tankDelays[4] = {5, 7, 9, 11};
+    for (int i = 0; i < 4; i++) {
+        limit = std::min(limit, scalePlateDelay(PLATE_REF_DELAYS[tankDelays[i]], sampleRate) - 1);
+    }
+    return std::max(limit, 1);
+}
+
+// out[i] += gain * buffer[start + i], with start and the run wrapped into
+// the ring
+template <typename T>
+inline void addDelayTapBlock(const T* buffer, int maxSize, int start, T* out, int n, float gain) {
+    while (start < 0) start += maxSize;
+    while (start >= maxSize) start -= maxSize;
+    for (int i = 0; i < n; i++) {
+        out[i] += gain * buffer[start];
+        if (++start >= maxSize) start = 0;
+    }
+}
 
 struct AllPassSection {
     float* buffer;
@@ -141,6 +201,30 @@ struct AllPassSection {
         if (readPos < 0) readPos += maxSize;
         return buffer[readPos];
     }
+
+    // process() over a block, in place
+    void processBlock(float* x, int n, float coefficient) {
+        if (!buffer) return;
+        for (int i = 0; i < n; i++) {
+            x[i] = process(x[i], coefficient);
+        }
+    }
+
+    void processModulatedBlock(float* x, int n, float coefficient, const float* modOffset) {
+        if (!buffer) return;
+        for (int i = 0; i < n; i++) {
+            x[i] = processModulated(x[i], coefficient, modOffset[i]);
+        }
+    }
+
+    // out[i] += gain * readTap(tapDelay) as it would read `offset + i`
+    // samples after the current write position
+    void addTapBlock(float* out, int n, int tapDelay, int offset, float gain) const {
+        if (!buffer) return;
+        if (tapDelay > size) tapDelay = size;
+        if (tapDelay < 0) tapDelay = 0;
+        addDelayTapBlock(buffer, maxSize, writePos + offset - tapDelay, out, n, gain);
+    }
 };
 
 struct DelaySection {
@@ -185,11 +269,42 @@ struct DelaySection {
         if (readPos < 0) readPos += maxSize;
         return buffer[readPos];
     }
+
+    // What read() will return after each of the next n writes. Only valid
+    // for n < size, where none of those writes is read back yet.
+    void readBlock(float* out, int n) const {
+        if (!buffer) {
+            std::memset(out, 0, n * sizeof(float));
+            return;
+        }
+        int readPos = writePos + 1 - size;
+        if (readPos < 0) readPos += maxSize;
+        for (int i = 0; i < n; i++) {
+            out[i] = buffer[readPos];
+            if (++readPos >= maxSize) readPos = 0;
+        }
+    }
+
+    void writeBlock(const float* in, int n) {
+        if (!buffer) return;
+        for (int i = 0; i < n; i++) {
+            buffer[writePos] = in[i];
+            if (++writePos >= maxSize) writePos = 0;
+        }
+    }
+
+    void addTapBlock(float* out, int n, int tapDelay, int offset, float gain) const {
+        if (!buffer) return;
+        if (tapDelay > size) tapDelay = size;
+        if (tapDelay < 0) tapDelay = 0;
+        addDelayTapBlock(buffer, maxSize, writePos + offset - tapDelay, out, n, gain);
+    }
 };
 
 class DattorroPlate {
 private:
     float* memoryBlock;
+    int memorySize;
 
     // Input diffusion: 4 cascaded allpasses
     AllPassSection inputAP[4];
@@ -230,29 +345,41 @@ private:
     float sampleRate;
     bool initialized;
 
+    // Block processing: renderBlock() leaves the decay and the tank feedback
+    // for writeBlock() to pick up
+    int blockLimit;
+    float blockDecay;
+    float blockFeedbackStart[2];
+    float blockFeedback[2][PLATE_MAX_BLOCK];
+
     int scaleDelay(int refDelay) {
-        return (int)(refDelay * sampleRate / DATTORRO_REF_RATE);
+        return scalePlateDelay(refDelay, sampleRate);
     }
 
+    // (Re)allocates one block sized for the current sample rate
     void allocateAndInit() {
-        if (memoryBlock) return;
-        memoryBlock = new float[TOTAL_BUFFER_SIZE]();
+        int sizes[PLATE_BUFFER_COUNT];
+        int total = plateBufferSizes(sampleRate, sizes);
+        if (memoryBlock && total == memorySize) return;
+
+        delete[] memoryBlock;
+        memoryBlock = new float[total]();
+        memorySize = total;
 
         int offset = 0;
-        inputAP[0].init(&memoryBlock[offset], MAX_INPUT_AP1); offset += MAX_INPUT_AP1;
-        inputAP[1].init(&memoryBlock[offset], MAX_INPUT_AP2); offset += MAX_INPUT_AP2;
-        inputAP[2].init(&memoryBlock[offset], MAX_INPUT_AP3); offset += MAX_INPUT_AP3;
-        inputAP[3].init(&memoryBlock[offset], MAX_INPUT_AP4); offset += MAX_INPUT_AP4;
+        for (int i = 0; i < 4; i++) {
+            inputAP[i].init(&memoryBlock[offset], sizes[i]); offset += sizes[i];
+        }
 
-        modAP_L.init(&memoryBlock[offset], MAX_TANK_MOD_AP_L); offset += MAX_TANK_MOD_AP_L;
-        delay1_L.init(&memoryBlock[offset], MAX_TANK_DELAY1_L); offset += MAX_TANK_DELAY1_L;
-        ap2_L.init(&memoryBlock[offset], MAX_TANK_AP2_L); offset += MAX_TANK_AP2_L;
-        delay2_L.init(&memoryBlock[offset], MAX_TANK_DELAY2_L); offset += MAX_TANK_DELAY2_L;
+        modAP_L.init(&memoryBlock[offset], sizes[4]); offset += sizes[4];
+        delay1_L.init(&memoryBlock[offset], sizes[5]); offset += sizes[5];
+        ap2_L.init(&memoryBlock[offset], sizes[6]); offset += sizes[6];
+        delay2_L.init(&memoryBlock[offset], sizes[7]); offset += sizes[7];
 
-        modAP_R.init(&memoryBlock[offset], MAX_TANK_MOD_AP_R); offset += MAX_TANK_MOD_AP_R;
-        delay1_R.init(&memoryBlock[offset], MAX_TANK_DELAY1_R); offset += MAX_TANK_DELAY1_R;
-        ap2_R.init(&memoryBlock[offset], MAX_TANK_AP2_R); offset += MAX_TANK_AP2_R;
-        delay2_R.init(&memoryBlock[offset], MAX_TANK_DELAY2_R); offset += MAX_TANK_DELAY2_R;
+        modAP_R.init(&memoryBlock[offset], sizes[8]); offset += sizes[8];
+        delay1_R.init(&memoryBlock[offset], sizes[9]); offset += sizes[9];
+        ap2_R.init(&memoryBlock[offset], sizes[10]); offset += sizes[10];
+        delay2_R.init(&memoryBlock[offset], sizes[11]); offset += sizes[11];
 
         initialized = true;
     }
@@ -261,7 +388,7 @@ public:
     float lastTankOut[2];
     float modDepthScale;
 
-    DattorroPlate() : memoryBlock(NULL), initialized(false) {
+    DattorroPlate() : memoryBlock(NULL), memorySize(0), initialized(false), blockLimit(1), blockDecay(0.0f) {
         std::memset(dampState, 0, sizeof(dampState));
         std::memset(tankFeedback, 0, sizeof(tankFeedback));
         std::memset(lastTankOut, 0, sizeof(lastTankOut));
@@ -278,7 +405,7 @@ public:
         delete[] memoryBlock;
     }
 
-    DattorroPlate(const DattorroPlate&) : memoryBlock(NULL), initialized(false) {
+    DattorroPlate(const DattorroPlate&) : memoryBlock(NULL), memorySize(0), initialized(false), blockLimit(1), blockDecay(0.0f) {
         std::memset(dampState, 0, sizeof(dampState));
         std::memset(tankFeedback, 0, sizeof(tankFeedback));
         std::memset(lastTankOut, 0, sizeof(lastTankOut));
@@ -345,11 +472,13 @@ public:
         tapR_d1r   = scaleDelay(TAP_R_FROM_D1R);
         tapR_ap2r  = scaleDelay(TAP_R_FROM_AP2R);
         tapR_d2r   = scaleDelay(TAP_R_FROM_D2R);
+
+        blockLimit = plateBlockLimit(sampleRate);
     }
 
     void reset() {
         if (memoryBlock) {
-            std::memset(memoryBlock, 0, TOTAL_BUFFER_SIZE * sizeof(float));
+            std::memset(memoryBlock, 0, memorySize * sizeof(float));
         }
         std::memset(dampState, 0, sizeof(dampState));
         std::memset(tankFeedback, 0, sizeof(tankFeedback));
@@ -498,9 +627,711 @@ public:
         if (!std::isfinite(tankFeedback[1])) tankFeedback[1] = 0.0f;
     }
 
+    // ============================================================
+    // BLOCK API
+    // The tank's shortest path from input to output is hundreds of
+    // samples, so a block's output never depends on that block's input.
+    // renderBlock() produces the output (and the tank outputs modes feed
+    // back) for the next n samples before their input is known;
+    // writeBlock() then takes the input for those same samples. Each
+    // stage runs as one loop over the block instead of hopping across
+    // all twelve buffers every sample. The pair matches n calls of the
+    // per-sample process() exactly, with modDepthScale and the LFO rate
+    // held for the block. n must not exceed getBlockLimit().
+    // ============================================================
+
+    void renderBlock(float decay, float damping, float* outL, float* outR,
+                     float* tankL, float* tankR, int n) {
+        if (!initialized) {
+            for (int i = 0; i < n; i++) {
+                outL[i] = outR[i] = tankL[i] = tankR[i] = 0.0f;
+            }
+            return;
+        }
+
+        decay = rack::math::clamp(decay, 0.0f, 0.99f);
+        damping = rack::math::clamp(damping, 0.0f, 0.99f);
+        blockDecay = decay;
+        blockFeedbackStart[0] = tankFeedback[0];
+        blockFeedbackStart[1] = tankFeedback[1];
+
+        const float decayDiffCoeff2 = 0.5f;
+        float work[PLATE_MAX_BLOCK];
+
+        // Left half: delay1_L -> damp -> decay -> ap2_L -> delay2_L
+        delay1_L.readBlock(work, n);
+        for (int i = 0; i < n; i++) {
+            dampState[0] = work[i] * (1.0f - damping) + dampState[0] * damping;
+            work[i] = dampState[0] * decay;
+            if (!std::isfinite(dampState[0])) dampState[0] = 0.0f;
+        }
+        ap2_L.processBlock(work, n, decayDiffCoeff2);
+        delay2_L.readBlock(tankL, n);
+        delay2_L.writeBlock(work, n);
+
+        // Right half: delay1_R -> damp -> decay -> ap2_R -> delay2_R
+        delay1_R.readBlock(work, n);
+        for (int i = 0; i < n; i++) {
+            dampState[1] = work[i] * (1.0f - damping) + dampState[1] * damping;
+            work[i] = dampState[1] * decay;
+            if (!std::isfinite(dampState[1])) dampState[1] = 0.0f;
+        }
+        ap2_R.processBlock(work, n, decayDiffCoeff2);
+        delay2_R.readBlock(tankR, n);
+        delay2_R.writeBlock(work, n);
+
+        for (int i = 0; i < n; i++) {
+            blockFeedback[0][i] = std::isfinite(tankL[i]) ? tankL[i] : 0.0f;
+            blockFeedback[1][i] = std::isfinite(tankR[i]) ? tankR[i] : 0.0f;
+        }
+        tankFeedback[0] = blockFeedback[0][n - 1];
+        tankFeedback[1] = blockFeedback[1][n - 1];
+        lastTankOut[0] = tankL[n - 1];
+        lastTankOut[1] = tankR[n - 1];
+
+        // Output taps, same order as process(). delay1 hasn't been written
+        // for this block yet; AP2 and delay2 already have.
+        for (int i = 0; i < n; i++) {
+            outL[i] = outR[i] = 0.0f;
+        }
+        delay1_R.addTapBlock(outL, n, tapL_d1r_a, 1, 1.0f);
+        delay1_R.addTapBlock(outL, n, tapL_d1r_b, 1, 1.0f);
+        ap2_R.addTapBlock(outL, n, tapL_ap2r, 1 - n, -1.0f);
+        delay2_R.addTapBlock(outL, n, tapL_d2r, 1 - n, 1.0f);
+        delay1_L.addTapBlock(outL, n, tapL_d1l, 1, -1.0f);
+        ap2_L.addTapBlock(outL, n, tapL_ap2l, 1 - n, -1.0f);
+        delay2_L.addTapBlock(outL, n, tapL_d2l, 1 - n, -1.0f);
+
+        delay1_L.addTapBlock(outR, n, tapR_d1l_a, 1, 1.0f);
+        delay1_L.addTapBlock(outR, n, tapR_d1l_b, 1, 1.0f);
+        ap2_L.addTapBlock(outR, n, tapR_ap2l, 1 - n, -1.0f);
+        delay2_L.addTapBlock(outR, n, tapR_d2l, 1 - n, 1.0f);
+        delay1_R.addTapBlock(outR, n, tapR_d1r, 1, -1.0f);
+        ap2_R.addTapBlock(outR, n, tapR_ap2r, 1 - n, -1.0f);
+        delay2_R.addTapBlock(outR, n, tapR_d2r, 1 - n, -1.0f);
+
+        for (int i = 0; i < n; i++) {
+            outL[i] *= 1.4f;
+            outR[i] *= 1.4f;
+            if (!std::isfinite(outL[i]) || std::fabs(outL[i]) < 1e-20f) outL[i] = 0.0f;
+            if (!std::isfinite(outR[i]) || std::fabs(outR[i]) < 1e-20f) outR[i] = 0.0f;
+        }
+    }
+
+    void writeBlock(const float* inputL, const float* inputR, int n) {
+        if (!initialized) return;
+
+        const float inputDiffCoeff1 = 0.75f;
+        const float inputDiffCoeff2 = 0.625f;
+        const float decayDiffCoeff1 = 0.7f;
+
+        // Input diffusion
+        float diffused[PLATE_MAX_BLOCK];
+        for (int i = 0; i < n; i++) {
+            diffused[i] = (inputL[i] + inputR[i]) * 0.5f;
+        }
+        inputAP[0].processBlock(diffused, n, inputDiffCoeff1);
+        inputAP[1].processBlock(diffused, n, inputDiffCoeff1);
+        inputAP[2].processBlock(diffused, n, inputDiffCoeff2);
+        inputAP[3].processBlock(diffused, n, inputDiffCoeff2);
+
+        // LFO
+        float lfo1[PLATE_MAX_BLOCK], lfo2[PLATE_MAX_BLOCK];
+        for (int i = 0; i < n; i++) {
+            lfoRateSmoothed += smoothCoeff * (lfoRate - lfoRateSmoothed);
+            modDepthScaleSmoothed += smoothCoeff * (modDepthScale - modDepthScaleSmoothed);
+            lfoPhase += lfoRateSmoothed * 2.0f * (float)M_PI / sampleRate;
+            if (lfoPhase >= 2.0f * (float)M_PI) lfoPhase -= 2.0f * (float)M_PI;
+
+            float modDepth = 8.0f * (sampleRate / DATTORRO_REF_RATE) * modDepthScaleSmoothed;
+            lfo1[i] = std::sin(lfoPhase) * modDepth;
+            lfo2[i] = std::sin(lfoPhase + 1.5707963f) * modDepth;
+        }
+
+        // Cross-coupled tank inputs through the modulated allpasses into delay1
+        float work[PLATE_MAX_BLOCK];
+        for (int i = 0; i < n; i++) {
+            float feedback = (i == 0) ? blockFeedbackStart[1] : blockFeedback[1][i - 1];
+            work[i] = diffused[i] + feedback * blockDecay;
+        }
+        modAP_L.processModulatedBlock(work, n, decayDiffCoeff1, lfo1);
+        delay1_L.writeBlock(work, n);
+
+        for (int i = 0; i < n; i++) {
+            float feedback = (i == 0) ? blockFeedbackStart[0] : blockFeedback[0][i - 1];
+            work[i] = diffused[i] + feedback * blockDecay;
+        }
+        modAP_R.processModulatedBlock(work, n, decayDiffCoeff1, lfo2);
+        delay1_R.writeBlock(work, n);
+    }
+
+    // Block counterpart of process(); any n, run in chunks of getBlockLimit()
+    void process(const float* inputL, const float* inputR, float decay, float damping,
+                 float* outL, float* outR, int n) {
+        float tankL[PLATE_MAX_BLOCK], tankR[PLATE_MAX_BLOCK];
+        for (int start = 0; start < n; start += blockLimit) {
+            int chunk = std::min(blockLimit, n - start);
+            renderBlock(decay, damping, outL + start, outR + start, tankL, tankR, chunk);
+            writeBlock(inputL + start, inputR + start, chunk);
+        }
+    }
+
+    int getBlockLimit() const {
+        return blockLimit;
+    }
+
     void setLFORate(float rate) {
         lfoRate = rack::math::clamp(rate, 0.1f, 10.0f);
     }
+
+    float getSampleRate() const {
+        return sampleRate;
+    }
+
+    // Delay memory currently held, in bytes
+    size_t getMemoryBytes() const {
+        return (size_t)memorySize * sizeof(float);
+    }
+};
+
+// ============================================================================
+// FOUR-VOICE PLATE
+// ============================================================================
+//
+// Every voice's plate has the same delay lengths, so four of them can share
+// one set of buffers with the voices interleaved: each tap is a float_4 and
+// a single write position serves all lanes. The diffusion chain, tank,
+// damping and output taps then run once for four voices. Only the modulated
+// allpass reads per lane, because each voice has its own LFO rate and depth.
+
+struct AllPassSection4 {
+    typedef rack::simd::float_4 float_4;
+
+    float_4* buffer;
+    int size;
+    int maxSize;
+    int writePos;
+
+    AllPassSection4() : buffer(NULL), size(0), maxSize(0), writePos(0) {}
+
+    void init(float_4* buf, int maxSz) {
+        buffer = buf;
+        maxSize = maxSz;
+        size = 0;
+        writePos = 0;
+    }
+
+    void setSize(int sz) {
+        size = (sz < maxSize) ? sz : maxSize - 1;
+        if (size < 1) size = 1;
+    }
+
+    float_4 process(float_4 input, float coefficient) {
+        int readPos = writePos - size;
+        if (readPos < 0) readPos += maxSize;
+
+        float_4 output = -coefficient * input + buffer[readPos];
+        buffer[writePos] = input + coefficient * output;
+
+        writePos++;
+        if (writePos >= maxSize) writePos = 0;
+
+        return output;
+    }
+
+    float_4 processModulated(float_4 input, float coefficient, float_4 modOffset) {
+        float_4 delayF = rack::simd::clamp((float)size + modOffset, 1.0f, (float)(maxSize - 2));
+        float_4 intDelay = rack::simd::floor(delayF);
+        float_4 frac = delayF - intDelay;
+
+        // Per-lane fractional read
+        float_4 delayed;
+        for (int lane = 0; lane < 4; lane++) {
+            int readPos1 = writePos - (int)intDelay[lane];
+            if (readPos1 < 0) readPos1 += maxSize;
+            int readPos2 = readPos1 - 1;
+            if (readPos2 < 0) readPos2 += maxSize;
+            delayed[lane] = buffer[readPos1][lane] * (1.0f - frac[lane]) + buffer[readPos2][lane] * frac[lane];
+        }
+
+        float_4 output = -coefficient * input + delayed;
+        buffer[writePos] = input + coefficient * output;
+
+        writePos++;
+        if (writePos >= maxSize) writePos = 0;
+
+        return output;
+    }
+
+    float_4 readTap(int tapDelay) const {
+        if (tapDelay > size) tapDelay = size;
+        if (tapDelay < 0) tapDelay = 0;
+        int readPos = writePos - tapDelay;
+        if (readPos < 0) readPos += maxSize;
+        return buffer[readPos];
+    }
+
+    void processBlock(float_4* x, int n, float coefficient) {
+        for (int i = 0; i < n; i++) {
+            x[i] = process(x[i], coefficient);
+        }
+    }
+
+    void processModulatedBlock(float_4* x, int n, float coefficient, const float_4* modOffset) {
+        for (int i = 0; i < n; i++) {
+            x[i] = processModulated(x[i], coefficient, modOffset[i]);
+        }
+    }
+
+    void addTapBlock(float_4* out, int n, int tapDelay, int offset, float gain) const {
+        if (tapDelay > size) tapDelay = size;
+        if (tapDelay < 0) tapDelay = 0;
+        addDelayTapBlock(buffer, maxSize, writePos + offset - tapDelay, out, n, gain);
+    }
+};
+
+struct DelaySection4 {
+    typedef rack::simd::float_4 float_4;
+
+    float_4* buffer;
+    int size;
+    int maxSize;
+    int writePos;
+
+    DelaySection4() : buffer(NULL), size(0), maxSize(0), writePos(0) {}
+
+    void init(float_4* buf, int maxSz) {
+        buffer = buf;
+        maxSize = maxSz;
+        size = 0;
+        writePos = 0;
+    }
+
+    void setSize(int sz) {
+        size = (sz < maxSize) ? sz : maxSize - 1;
+        if (size < 1) size = 1;
+    }
+
+    void write(float_4 input) {
+        buffer[writePos] = input;
+        writePos++;
+        if (writePos >= maxSize) writePos = 0;
+    }
+
+    float_4 read() const {
+        int readPos = writePos - size;
+        if (readPos < 0) readPos += maxSize;
+        return buffer[readPos];
+    }
+
+    float_4 readTap(int tapDelay) const {
+        if (tapDelay > size) tapDelay = size;
+        if (tapDelay < 0) tapDelay = 0;
+        int readPos = writePos - tapDelay;
+        if (readPos < 0) readPos += maxSize;
+        return buffer[readPos];
+    }
+
+    void readBlock(float_4* out, int n) const {
+        int readPos = writePos + 1 - size;
+        if (readPos < 0) readPos += maxSize;
+        for (int i = 0; i < n; i++) {
+            out[i] = buffer[readPos];
+            if (++readPos >= maxSize) readPos = 0;
+        }
+    }
+
+    void writeBlock(const float_4* in, int n) {
+        for (int i = 0; i < n; i++) {
+            buffer[writePos] = in[i];
+            if (++writePos >= maxSize) writePos = 0;
+        }
+    }
+
+    void addTapBlock(float_4* out, int n, int tapDelay, int offset, float gain) const {
+        if (tapDelay > size) tapDelay = size;
+        if (tapDelay < 0) tapDelay = 0;
+        addDelayTapBlock(buffer, maxSize, writePos + offset - tapDelay, out, n, gain);
+    }
+};
+
+// DattorroPlate for four voices in the lanes of a float_4. Same algorithm and
+// output as four DattorroPlates fed lane by lane; decay, damping, LFO rate and
+// modulation depth are per lane.
+class DattorroPlate4 {
+public:
+    typedef rack::simd::float_4 float_4;
+
+    float_4 lastTankOut[2];
+    float_4 modDepthScale;
+
+    DattorroPlate4() : memoryBlock(NULL), memorySize(0), initialized(false), blockLimit(1) {
+        lastTankOut[0] = lastTankOut[1] = 0.0f;
+        modDepthScale = 1.0f;
+        dampState[0] = dampState[1] = 0.0f;
+        tankFeedback[0] = tankFeedback[1] = 0.0f;
+        lfoPhase = 0.0f;
+        lfoRate = 1.0f;
+        lfoRateSmoothed = 1.0f;
+        modDepthScaleSmoothed = 1.0f;
+        smoothCoeff = 0.0005f;
+        sampleRate = 44100.0f;
+    }
+
+    ~DattorroPlate4() {
+        delete[] memoryBlock;
+    }
+
+    DattorroPlate4(const DattorroPlate4&) = delete;
+    DattorroPlate4& operator=(const DattorroPlate4&) = delete;
+
+    void setSampleRate(float sr) {
+        sampleRate = sr;
+        smoothCoeff = 1.0f - std::exp(-2.0f * (float)M_PI * 5.0f / sampleRate);
+
+        int sizes[PLATE_BUFFER_COUNT];
+        int total = plateBufferSizes(sampleRate, sizes);
+        if (!memoryBlock || total != memorySize) {
+            delete[] memoryBlock;
+            memoryBlock = new float_4[total]();
+            memorySize = total;
+        }
+        AllPassSection4* allpasses[6] = {&inputAP[0], &inputAP[1], &inputAP[2], &inputAP[3], &ap2_L, &ap2_R};
+        const int allpassBuffers[6] = {0, 1, 2, 3, 6, 10};
+        DelaySection4* delays[4] = {&delay1_L, &delay2_L, &delay1_R, &delay2_R};
+        const int delayBuffers[4] = {5, 7, 9, 11};
+
+        int offsets[PLATE_BUFFER_COUNT];
+        int offset = 0;
+        for (int i = 0; i < PLATE_BUFFER_COUNT; i++) {
+            offsets[i] = offset;
+            offset += sizes[i];
+        }
+        for (int i = 0; i < 6; i++) {
+            allpasses[i]->init(&memoryBlock[offsets[allpassBuffers[i]]], sizes[allpassBuffers[i]]);
+        }
+        for (int i = 0; i < 4; i++) {
+            delays[i]->init(&memoryBlock[offsets[delayBuffers[i]]], sizes[delayBuffers[i]]);
+        }
+        modAP_L.init(&memoryBlock[offsets[4]], sizes[4]);
+        modAP_R.init(&memoryBlock[offsets[8]], sizes[8]);
+
+        inputAP[0].setSize(scaleDelay(REF_INPUT_AP1));
+        inputAP[1].setSize(scaleDelay(REF_INPUT_AP2));
+        inputAP[2].setSize(scaleDelay(REF_INPUT_AP3));
+        inputAP[3].setSize(scaleDelay(REF_INPUT_AP4));
+        modAP_L.setSize(scaleDelay(REF_TANK_MOD_AP_L));
+        delay1_L.setSize(scaleDelay(REF_TANK_DELAY1_L));
+        ap2_L.setSize(scaleDelay(REF_TANK_AP2_L));
+        delay2_L.setSize(scaleDelay(REF_TANK_DELAY2_L));
+        modAP_R.setSize(scaleDelay(REF_TANK_MOD_AP_R));
+        delay1_R.setSize(scaleDelay(REF_TANK_DELAY1_R));
+        ap2_R.setSize(scaleDelay(REF_TANK_AP2_R));
+        delay2_R.setSize(scaleDelay(REF_TANK_DELAY2_R));
+
+        tapL_d1r_a = scaleDelay(TAP_L_FROM_D1R_A);
+        tapL_d1r_b = scaleDelay(TAP_L_FROM_D1R_B);
+        tapL_ap2r  = scaleDelay(TAP_L_FROM_AP2R);
+        tapL_d2r   = scaleDelay(TAP_L_FROM_D2R);
+        tapL_d1l   = scaleDelay(TAP_L_FROM_D1L);
+        tapL_ap2l  = scaleDelay(TAP_L_FROM_AP2L);
+        tapL_d2l   = scaleDelay(TAP_L_FROM_D2L);
+
+        tapR_d1l_a = scaleDelay(TAP_R_FROM_D1L_A);
+        tapR_d1l_b = scaleDelay(TAP_R_FROM_D1L_B);
+        tapR_ap2l  = scaleDelay(TAP_R_FROM_AP2L);
+        tapR_d2l   = scaleDelay(TAP_R_FROM_D2L);
+        tapR_d1r   = scaleDelay(TAP_R_FROM_D1R);
+        tapR_ap2r  = scaleDelay(TAP_R_FROM_AP2R);
+        tapR_d2r   = scaleDelay(TAP_R_FROM_D2R);
+
+        blockLimit = plateBlockLimit(sampleRate);
+        initialized = true;
+    }
+
+    void reset() {
+        if (memoryBlock) {
+            for (int i = 0; i < memorySize; i++) memoryBlock[i] = 0.0f;
+        }
+        dampState[0] = dampState[1] = 0.0f;
+        tankFeedback[0] = tankFeedback[1] = 0.0f;
+        lastTankOut[0] = lastTankOut[1] = 0.0f;
+        lfoPhase = 0.0f;
+        lfoRateSmoothed = lfoRate;
+        modDepthScaleSmoothed = modDepthScale;
+
+        for (int i = 0; i < 4; i++) inputAP[i].writePos = 0;
+        modAP_L.writePos = 0;
+        delay1_L.writePos = 0;
+        ap2_L.writePos = 0;
+        delay2_L.writePos = 0;
+        modAP_R.writePos = 0;
+        delay1_R.writePos = 0;
+        ap2_R.writePos = 0;
+        delay2_R.writePos = 0;
+    }
+
+    void process(float_4 inputL, float_4 inputR, float_4 decay, float_4 damping,
+                 float_4& outL, float_4& outR) {
+        if (!initialized) {
+            outL = outR = 0.0f;
+            return;
+        }
+
+        decay = rack::simd::clamp(decay, 0.0f, 0.99f);
+        damping = rack::simd::clamp(damping, 0.0f, 0.99f);
+
+        const float inputDiffCoeff1 = 0.75f;
+        const float inputDiffCoeff2 = 0.625f;
+        const float decayDiffCoeff1 = 0.7f;
+        const float decayDiffCoeff2 = 0.5f;
+
+        float_4 diffused = (inputL + inputR) * 0.5f;
+        diffused = inputAP[0].process(diffused, inputDiffCoeff1);
+        diffused = inputAP[1].process(diffused, inputDiffCoeff1);
+        diffused = inputAP[2].process(diffused, inputDiffCoeff2);
+        diffused = inputAP[3].process(diffused, inputDiffCoeff2);
+
+        lfoRateSmoothed += smoothCoeff * (lfoRate - lfoRateSmoothed);
+        modDepthScaleSmoothed += smoothCoeff * (modDepthScale - modDepthScaleSmoothed);
+
+        const float twoPi = 2.0f * (float)M_PI;
+        lfoPhase += lfoRateSmoothed * twoPi / sampleRate;
+        lfoPhase = rack::simd::ifelse(lfoPhase >= twoPi, lfoPhase - twoPi, lfoPhase);
+
+        float_4 modDepth = 8.0f * (sampleRate / DATTORRO_REF_RATE) * modDepthScaleSmoothed;
+        float_4 lfo1 = rack::simd::sin(lfoPhase) * modDepth;
+        float_4 lfo2 = rack::simd::sin(lfoPhase + 1.5707963f) * modDepth;
+
+        // Left half: modAP_L -> delay1_L -> damp -> decay -> ap2_L -> delay2_L
+        float_4 leftIn = diffused + tankFeedback[1] * decay;
+        delay1_L.write(modAP_L.processModulated(leftIn, decayDiffCoeff1, lfo1));
+        dampState[0] = delay1_L.read() * (1.0f - damping) + dampState[0] * damping;
+        delay2_L.write(ap2_L.process(dampState[0] * decay, decayDiffCoeff2));
+        float_4 leftOut = delay2_L.read();
+
+        // Right half: modAP_R -> delay1_R -> damp -> decay -> ap2_R -> delay2_R
+        float_4 rightIn = diffused + tankFeedback[0] * decay;
+        delay1_R.write(modAP_R.processModulated(rightIn, decayDiffCoeff1, lfo2));
+        dampState[1] = delay1_R.read() * (1.0f - damping) + dampState[1] * damping;
+        delay2_R.write(ap2_R.process(dampState[1] * decay, decayDiffCoeff2));
+        float_4 rightOut = delay2_R.read();
+
+        tankFeedback[0] = leftOut;
+        tankFeedback[1] = rightOut;
+        lastTankOut[0] = leftOut;
+        lastTankOut[1] = rightOut;
+
+        outL =   delay1_R.readTap(tapL_d1r_a)
+               + delay1_R.readTap(tapL_d1r_b)
+               - ap2_R.readTap(tapL_ap2r)
+               + delay2_R.readTap(tapL_d2r)
+               - delay1_L.readTap(tapL_d1l)
+               - ap2_L.readTap(tapL_ap2l)
+               - delay2_L.readTap(tapL_d2l);
+
+        outR =   delay1_L.readTap(tapR_d1l_a)
+               + delay1_L.readTap(tapR_d1l_b)
+               - ap2_L.readTap(tapR_ap2l)
+               + delay2_L.readTap(tapR_d2l)
+               - delay1_R.readTap(tapR_d1r)
+               - ap2_R.readTap(tapR_ap2r)
+               - delay2_R.readTap(tapR_d2r);
+
+        outL *= 1.4f;
+        outR *= 1.4f;
+
+        // Same denormal/NaN guards as the scalar plate; NaN fails both comparisons
+        outL = rack::simd::ifelse(isAudible(outL), outL, 0.0f);
+        outR = rack::simd::ifelse(isAudible(outR), outR, 0.0f);
+        dampState[0] = rack::simd::ifelse(isFinite(dampState[0]), dampState[0], 0.0f);
+        dampState[1] = rack::simd::ifelse(isFinite(dampState[1]), dampState[1], 0.0f);
+        tankFeedback[0] = rack::simd::ifelse(isFinite(tankFeedback[0]), tankFeedback[0], 0.0f);
+        tankFeedback[1] = rack::simd::ifelse(isFinite(tankFeedback[1]), tankFeedback[1], 0.0f);
+    }
+
+    // Block API, as on DattorroPlate
+    void renderBlock(float_4 decay, float_4 damping, float_4* outL, float_4* outR,
+                     float_4* tankL, float_4* tankR, int n) {
+        if (!initialized) {
+            for (int i = 0; i < n; i++) {
+                outL[i] = outR[i] = tankL[i] = tankR[i] = 0.0f;
+            }
+            return;
+        }
+
+        decay = rack::simd::clamp(decay, 0.0f, 0.99f);
+        damping = rack::simd::clamp(damping, 0.0f, 0.99f);
+        blockDecay = decay;
+        blockFeedbackStart[0] = tankFeedback[0];
+        blockFeedbackStart[1] = tankFeedback[1];
+
+        const float decayDiffCoeff2 = 0.5f;
+        float_4 work[PLATE_MAX_BLOCK];
+
+        delay1_L.readBlock(work, n);
+        for (int i = 0; i < n; i++) {
+            dampState[0] = work[i] * (1.0f - damping) + dampState[0] * damping;
+            work[i] = dampState[0] * decay;
+            dampState[0] = rack::simd::ifelse(isFinite(dampState[0]), dampState[0], 0.0f);
+        }
+        ap2_L.processBlock(work, n, decayDiffCoeff2);
+        delay2_L.readBlock(tankL, n);
+        delay2_L.writeBlock(work, n);
+
+        delay1_R.readBlock(work, n);
+        for (int i = 0; i < n; i++) {
+            dampState[1] = work[i] * (1.0f - damping) + dampState[1] * damping;
+            work[i] = dampState[1] * decay;
+            dampState[1] = rack::simd::ifelse(isFinite(dampState[1]), dampState[1], 0.0f);
+        }
+        ap2_R.processBlock(work, n, decayDiffCoeff2);
+        delay2_R.readBlock(tankR, n);
+        delay2_R.writeBlock(work, n);
+
+        for (int i = 0; i < n; i++) {
+            blockFeedback[0][i] = rack::simd::ifelse(isFinite(tankL[i]), tankL[i], 0.0f);
+            blockFeedback[1][i] = rack::simd::ifelse(isFinite(tankR[i]), tankR[i], 0.0f);
+        }
+        tankFeedback[0] = blockFeedback[0][n - 1];
+        tankFeedback[1] = blockFeedback[1][n - 1];
+        lastTankOut[0] = tankL[n - 1];
+        lastTankOut[1] = tankR[n - 1];
+
+        for (int i = 0; i < n; i++) {
+            outL[i] = outR[i] = 0.0f;
+        }
+        delay1_R.addTapBlock(outL, n, tapL_d1r_a, 1, 1.0f);
+        delay1_R.addTapBlock(outL, n, tapL_d1r_b, 1, 1.0f);
+        ap2_R.addTapBlock(outL, n, tapL_ap2r, 1 - n, -1.0f);
+        delay2_R.addTapBlock(outL, n, tapL_d2r, 1 - n, 1.0f);
+        delay1_L.addTapBlock(outL, n, tapL_d1l, 1, -1.0f);
+        ap2_L.addTapBlock(outL, n, tapL_ap2l, 1 - n, -1.0f);
+        delay2_L.addTapBlock(outL, n, tapL_d2l, 1 - n, -1.0f);
+
+        delay1_L.addTapBlock(outR, n, tapR_d1l_a, 1, 1.0f);
+        delay1_L.addTapBlock(outR, n, tapR_d1l_b, 1, 1.0f);
+        ap2_L.addTapBlock(outR, n, tapR_ap2l, 1 - n, -1.0f);
+        delay2_L.addTapBlock(outR, n, tapR_d2l, 1 - n, 1.0f);
+        delay1_R.addTapBlock(outR, n, tapR_d1r, 1, -1.0f);
+        ap2_R.addTapBlock(outR, n, tapR_ap2r, 1 - n, -1.0f);
+        delay2_R.addTapBlock(outR, n, tapR_d2r, 1 - n, -1.0f);
+
+        for (int i = 0; i < n; i++) {
+            outL[i] *= 1.4f;
+            outR[i] *= 1.4f;
+            outL[i] = rack::simd::ifelse(isAudible(outL[i]), outL[i], 0.0f);
+            outR[i] = rack::simd::ifelse(isAudible(outR[i]), outR[i], 0.0f);
+        }
+    }
+
+    void writeBlock(const float_4* inputL, const float_4* inputR, int n) {
+        if (!initialized) return;
+
+        const float inputDiffCoeff1 = 0.75f;
+        const float inputDiffCoeff2 = 0.625f;
+        const float decayDiffCoeff1 = 0.7f;
+
+        float_4 diffused[PLATE_MAX_BLOCK];
+        for (int i = 0; i < n; i++) {
+            diffused[i] = (inputL[i] + inputR[i]) * 0.5f;
+        }
+        inputAP[0].processBlock(diffused, n, inputDiffCoeff1);
+        inputAP[1].processBlock(diffused, n, inputDiffCoeff1);
+        inputAP[2].processBlock(diffused, n, inputDiffCoeff2);
+        inputAP[3].processBlock(diffused, n, inputDiffCoeff2);
+
+        const float twoPi = 2.0f * (float)M_PI;
+        float_4 lfo1[PLATE_MAX_BLOCK], lfo2[PLATE_MAX_BLOCK];
+        for (int i = 0; i < n; i++) {
+            lfoRateSmoothed += smoothCoeff * (lfoRate - lfoRateSmoothed);
+            modDepthScaleSmoothed += smoothCoeff * (modDepthScale - modDepthScaleSmoothed);
+            lfoPhase += lfoRateSmoothed * twoPi / sampleRate;
+            lfoPhase = rack::simd::ifelse(lfoPhase >= twoPi, lfoPhase - twoPi, lfoPhase);
+
+            float_4 modDepth = 8.0f * (sampleRate / DATTORRO_REF_RATE) * modDepthScaleSmoothed;
+            lfo1[i] = rack::simd::sin(lfoPhase) * modDepth;
+            lfo2[i] = rack::simd::sin(lfoPhase + 1.5707963f) * modDepth;
+        }
+
+        float_4 work[PLATE_MAX_BLOCK];
+        for (int i = 0; i < n; i++) {
+            float_4 feedback = (i == 0) ? blockFeedbackStart[1] : blockFeedback[1][i - 1];
+            work[i] = diffused[i] + feedback * blockDecay;
+        }
+        modAP_L.processModulatedBlock(work, n, decayDiffCoeff1, lfo1);
+        delay1_L.writeBlock(work, n);
+
+        for (int i = 0; i < n; i++) {
+            float_4 feedback = (i == 0) ? blockFeedbackStart[0] : blockFeedback[0][i - 1];
+            work[i] = diffused[i] + feedback * blockDecay;
+        }
+        modAP_R.processModulatedBlock(work, n, decayDiffCoeff1, lfo2);
+        delay1_R.writeBlock(work, n);
+    }
+
+    int getBlockLimit() const {
+        return blockLimit;
+    }
+
+    void setLFORate(int lane, float rate) {
+        lfoRate[lane] = rack::math::clamp(rate, 0.1f, 10.0f);
+    }
+
+    float getSampleRate() const {
+        return sampleRate;
+    }
+
+    // Delay memory currently held, in bytes
+    size_t getMemoryBytes() const {
+        return (size_t)memorySize * sizeof(float_4);
+    }
+
+private:
+    float_4* memoryBlock;
+    int memorySize;
+
+    AllPassSection4 inputAP[4];
+    AllPassSection4 modAP_L;
+    DelaySection4   delay1_L;
+    AllPassSection4 ap2_L;
+    DelaySection4   delay2_L;
+    AllPassSection4 modAP_R;
+    DelaySection4   delay1_R;
+    AllPassSection4 ap2_R;
+    DelaySection4   delay2_R;
+
+    float_4 dampState[2];
+    float_4 tankFeedback[2];
+    float_4 lfoPhase;
+    float_4 lfoRate;
+    float_4 lfoRateSmoothed;
+    float_4 modDepthScaleSmoothed;
+    float smoothCoeff;
+
+    int tapL_d1r_a, tapL_d1r_b, tapL_ap2r, tapL_d2r, tapL_d1l, tapL_ap2l, tapL_d2l;
+    int tapR_d1l_a, tapR_d1l_b, tapR_ap2l, tapR_d2l, tapR_d1r, tapR_ap2r, tapR_d2r;
+
+    float sampleRate;
+    bool initialized;
+
+    int blockLimit;
+    float_4 blockDecay;
+    float_4 blockFeedbackStart[2];
+    float_4 blockFeedback[2][PLATE_MAX_BLOCK];
+
+    int scaleDelay(int refDelay) const {
+        return scalePlateDelay(refDelay, sampleRate);
+    }
+
+    static float_4 isFinite(float_4 x) {
+        return rack::simd::fabs(x) < INFINITY;
+    }
+
+    static float_4 isAudible(float_4 x) {
+        float_4 magnitude = rack::simd::fabs(x);
+        return (magnitude < INFINITY) & (magnitude >= 1e-20f);
+    }
 };
 
 } // namespace reverie
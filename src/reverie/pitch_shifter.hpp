@@ -7,37 +7,65 @@
 namespace shapetaker {
 namespace reverie {
 
-// Granular pitch shifter using two overlapping Hann-windowed grains
+// Hann window over one grain, sampled at SIZE + 1 points so a linear
+// interpolation can read any phase in [0, 1). Error is below 3e-6. Built
+// once and shared; prepare() touches it off the audio thread.
+struct GrainWindowTable {
+    static const int SIZE = 1024;
+    float values[SIZE + 1];
+
+    static const GrainWindowTable& shared() {
+        static const GrainWindowTable table;
+        return table;
+    }
+
+private:
+    GrainWindowTable() {
+        for (int i = 0; i <= SIZE; i++) {
+            values[i] = 0.5f * (1.0f - std::cos(2.0f * (float)M_PI * (float)i / (float)SIZE));
+        }
+    }
+};
+
+// Granular pitch shifter using overlapping Hann-windowed grains
 // Counter-based grain management for click-free crossfades
 // Designed for octave shifts (+12 or -12 semitones)
+// Two grains by default; four grains at quarter-grain offsets
+// (setGrainCount) smooth out the grain-rate flutter for twice the reads
 class GranularPitchShifter {
 private:
-    static const int MAX_BUFFER = 8192; // ~170ms at 48kHz
+    static const int MAX_BUFFER = 8192; // ~170ms at 48kHz, power of two
+    static const int BUFFER_MASK = MAX_BUFFER - 1;
+    static const int MAX_GRAINS = 4;
     float* buffer;
     int writePos;
     int grainSizeSamples;
     float pitchRatio; // 2.0 = +1 octave, 0.5 = -1 octave
     bool initialized;
 
-    // Two grains with deterministic counter-based lifecycle
-    int grainAge[2];       // counter: 0 to grainSizeSamples-1
-    int grainStartPos[2];  // write position when grain was born
+    int grainCount;
+    float grainGain;   // keeps four grains as loud as two on uncorrelated input
+    float windowScale; // window table steps per sample of grain age
+    const float* window;
 
-    float hannWindow(float phase) {
-        return 0.5f * (1.0f - std::cos(2.0f * (float)M_PI * phase));
+    // Grains with deterministic counter-based lifecycle
+    int grainAge[MAX_GRAINS];       // counter: 0 to grainSizeSamples-1
+    int grainStartPos[MAX_GRAINS];  // write position when grain was born
+
+    float readWindow(int age) const {
+        float pos = (float)age * windowScale;
+        int idx = (int)pos;
+        float frac = pos - (float)idx;
+        return window[idx] + (window[idx + 1] - window[idx]) * frac;
     }
 
-    float readInterpolated(float pos) {
-        if (!buffer) return 0.0f;
-        // Wrap to buffer range
-        while (pos >= MAX_BUFFER) pos -= MAX_BUFFER;
-        while (pos < 0) pos += MAX_BUFFER;
-        int idx1 = (int)pos;
-        float frac = pos - (float)idx1;
-        idx1 = idx1 % MAX_BUFFER;
-        if (idx1 < 0) idx1 += MAX_BUFFER;
-        int idx2 = (idx1 + 1) % MAX_BUFFER;
-        return buffer[idx1] * (1.0f - frac) + buffer[idx2] * frac;
+    // pos is never negative: grains start inside the buffer and read forward
+    float readInterpolated(float pos) const {
+        int idx = (int)pos;
+        float frac = pos - (float)idx;
+        float a = buffer[idx & BUFFER_MASK];
+        float b = buffer[(idx + 1) & BUFFER_MASK];
+        return a + (b - a) * frac;
     }
 
     void allocate() {
@@ -49,19 +77,34 @@ private:
     void resetGrain(int idx) {
         grainAge[idx] = 0;
         // Start reading from grainSizeSamples behind the write head
-        grainStartPos[idx] = writePos - grainSizeSamples;
-        if (grainStartPos[idx] < 0) grainStartPos[idx] += MAX_BUFFER;
+        grainStartPos[idx] = (writePos - grainSizeSamples) & BUFFER_MASK;
     }
 
-public:
-    GranularPitchShifter() : buffer(NULL), initialized(false) {
+    // Spread the grains evenly over one grain length
+    void initGrains() {
+        for (int g = 0; g < grainCount; g++) {
+            resetGrain(g);
+            grainAge[g] = g * grainSizeSamples / grainCount;
+        }
+    }
+
+    void setDefaults() {
         writePos = 0;
         grainSizeSamples = 2048;
         pitchRatio = 2.0f;
-        grainAge[0] = 0;
-        grainAge[1] = 0;
-        grainStartPos[0] = 0;
-        grainStartPos[1] = 0;
+        grainCount = 2;
+        grainGain = 1.0f;
+        windowScale = (float)GrainWindowTable::SIZE / (float)grainSizeSamples;
+        window = NULL;
+        for (int g = 0; g < MAX_GRAINS; g++) {
+            grainAge[g] = 0;
+            grainStartPos[g] = 0;
+        }
+    }
+
+public:
+    GranularPitchShifter() : buffer(NULL), initialized(false) {
+        setDefaults();
     }
 
     ~GranularPitchShifter() {
@@ -69,31 +112,36 @@ public:
     }
 
     GranularPitchShifter(const GranularPitchShifter&) : buffer(NULL), initialized(false) {
-        writePos = 0;
-        grainSizeSamples = 2048;
-        pitchRatio = 2.0f;
-        grainAge[0] = 0;
-        grainAge[1] = 0;
-        grainStartPos[0] = 0;
-        grainStartPos[1] = 0;
+        setDefaults();
     }
 
     GranularPitchShifter& operator=(const GranularPitchShifter&) {
         return *this;
     }
 
+    // 2 or 4 grains; restarts the grain cycle
+    void setGrainCount(int count) {
+        grainCount = (count >= 4) ? 4 : 2;
+        // Grains read from different delays, so on reverb-like input they add
+        // in power: four overlapping Hann grains carry twice the energy of two
+        grainGain = (grainCount == 4) ? 0.70710678f : 1.0f;
+        initGrains();
+    }
+
+    int getGrainCount() const {
+        return grainCount;
+    }
+
     void setSampleRate(float sampleRate) {
         allocate();
+        window = GrainWindowTable::shared().values;
         // Grain size ~40ms for clean octave shifts
         grainSizeSamples = (int)(sampleRate * 0.04f);
         if (grainSizeSamples < 64) grainSizeSamples = 64;
         if (grainSizeSamples > MAX_BUFFER / 2) grainSizeSamples = MAX_BUFFER / 2;
+        windowScale = (float)GrainWindowTable::SIZE / (float)grainSizeSamples;
 
-        // Initialize grain 1 at age 0, grain 2 at half-grain offset
-        resetGrain(0);
-        grainAge[1] = grainSizeSamples / 2;
-        grainStartPos[1] = writePos - grainSizeSamples;
-        if (grainStartPos[1] < 0) grainStartPos[1] += MAX_BUFFER;
+        initGrains();
     }
 
     void setPitchRatio(float ratio) {
@@ -105,9 +153,7 @@ public:
             std::memset(buffer, 0, MAX_BUFFER * sizeof(float));
         }
         writePos = 0;
-        resetGrain(0);
-        grainAge[1] = grainSizeSamples / 2;
-        grainStartPos[1] = 0;
+        initGrains();
     }
 
     float process(float input) {
@@ -118,15 +164,10 @@ public:
 
         float output = 0.0f;
 
-        // Process both grains
-        for (int g = 0; g < 2; g++) {
-            // Phase 0..1 over grain lifetime
-            float phase = (float)grainAge[g] / (float)grainSizeSamples;
-            float window = hannWindow(phase);
-
+        for (int g = 0; g < grainCount; g++) {
             // Read position: start + age * pitchRatio
             float readPos = (float)grainStartPos[g] + (float)grainAge[g] * pitchRatio;
-            output += readInterpolated(readPos) * window;
+            output += readInterpolated(readPos) * readWindow(grainAge[g]);
 
             // Advance grain age
             grainAge[g]++;
@@ -138,9 +179,9 @@ public:
         }
 
         // Advance write position
-        writePos = (writePos + 1) % MAX_BUFFER;
+        writePos = (writePos + 1) & BUFFER_MASK;
 
-        return output;
+        return output * grainGain;
     }
 };
 
@@ -21,11 +21,25 @@ enum ReverbMode {
     MODE_MODULATED = 4
 };
 
+// What a mode asks of the plate for one sample. lfoRate <= 0 leaves the
+// plate's LFO rate as it is.
+struct PlateDrive {
+    float inL;
+    float inR;
+    float damping;
+    float modDepthScale;
+    float lfoRate;
+};
+
 // Per-voice reverb mode processor
-// Wraps the DattorroPlate and adds mode-specific pre/post processing
+// Wraps the DattorroPlate and adds mode-specific pre/post processing.
+// Only the components of the prepared mode own buffers; the rest stay
+// unallocated (and pass through or go silent) until prepare() picks them.
 class ReverbModeProcessor {
 private:
     float sampleRate;
+    int preparedMode;
+    int shifterGrains;
 
     // ---- Field Blur components ----
     shapetaker::dsp::ChorusEffect fieldBlurChorusL;
@@ -42,6 +56,7 @@ private:
     // ---- Reverse components ----
     ReverseGrainBuffer reverseBufferL;
     ReverseGrainBuffer reverseBufferR;
+    float reversedL, reversedR; // grain output fed to the plate, reused in the mix
 
     // ---- Lo-Fi components ----
     shapetaker::dsp::OnePoleLowpass lofiFilterL;
@@ -57,34 +72,68 @@ private:
 public:
     ReverbModeProcessor() {
         sampleRate = 44100.0f;
+        preparedMode = -1;
+        shifterGrains = 2;
         shimmerFeedbackL = shimmerFeedbackR = 0.0f;
+        reversedL = reversedR = 0.0f;
         lofiHoldL = lofiHoldR = 0.0f;
         lofiCounter = 0;
         lofiLfoPhase = 0.0f;
     }
 
-    void setSampleRate(float sr) {
+    // Allocates the components `mode` uses. Not real-time safe: call off the
+    // audio thread on a processor that is not yet published. `grains` (2 or
+    // 4) sets the overlap of the Field Blur and Afterimage pitch shifters.
+    void prepare(float sr, int mode, int grains = 2) {
         sampleRate = sr;
-        fieldBlurChorusL.setSampleRate(sr);
-        fieldBlurChorusR.setSampleRate(sr);
-        fieldBlurShimmer.setSampleRate(sr);
-        fieldBlurShimmer.setPitchRatio(2.0f); // +1 octave
+        preparedMode = mode;
+        shifterGrains = grains;
 
-        afterimageResonantL.reset();
-        afterimageResonantR.reset();
-        afterimageShifterL.setSampleRate(sr);
-        afterimageShifterR.setSampleRate(sr);
-        afterimageShifterL.setPitchRatio(0.5f); // -1 octave (dark)
-        afterimageShifterR.setPitchRatio(0.5f);
+        switch (mode) {
+            case MODE_FIELD_BLUR:
+                fieldBlurChorusL.setSampleRate(sr);
+                fieldBlurChorusR.setSampleRate(sr);
+                fieldBlurShimmer.setGrainCount(grains);
+                fieldBlurShimmer.setSampleRate(sr);
+                fieldBlurShimmer.setPitchRatio(2.0f); // +1 octave
+                break;
+            case MODE_AFTERIMAGE:
+                afterimageResonantL.reset();
+                afterimageResonantR.reset();
+                afterimageShifterL.setGrainCount(grains);
+                afterimageShifterR.setGrainCount(grains);
+                afterimageShifterL.setSampleRate(sr);
+                afterimageShifterR.setSampleRate(sr);
+                afterimageShifterL.setPitchRatio(0.5f); // -1 octave (dark)
+                afterimageShifterR.setPitchRatio(0.5f);
+                break;
+            case MODE_REVERSE:
+                reverseBufferL.setSampleRate(sr);
+                reverseBufferR.setSampleRate(sr);
+                break;
+            case MODE_LOFI:
+                lofiFilterL.reset();
+                lofiFilterR.reset();
+                break;
+            case MODE_MODULATED:
+                modulatedChorusL.setSampleRate(sr);
+                modulatedChorusR.setSampleRate(sr);
+                break;
+            default:
+                break;
+        }
+    }
 
-        reverseBufferL.setSampleRate(sr);
-        reverseBufferR.setSampleRate(sr);
+    int getPreparedMode() const {
+        return preparedMode;
+    }
 
-        lofiFilterL.reset();
-        lofiFilterR.reset();
+    float getSampleRate() const {
+        return sampleRate;
+    }
 
-        modulatedChorusL.setSampleRate(sr);
-        modulatedChorusR.setSampleRate(sr);
+    int getShifterGrains() const {
+        return shifterGrains;
     }
 
     void reset() {
@@ -98,6 +147,7 @@ public:
         afterimageShifterR.reset();
         reverseBufferL.reset();
         reverseBufferR.reset();
+        reversedL = reversedR = 0.0f;
         lofiFilterL.reset();
         lofiFilterR.reset();
         lofiHoldL = lofiHoldR = 0.0f;
@@ -114,27 +164,86 @@ public:
                  float param1, float param2,
                  int mode,
                  float& outL, float& outR) {
+        PlateDrive drive;
+        processPre(mode, inL, inR, damping, param1, param2,
+                   plate.lastTankOut[0], plate.lastTankOut[1], drive);
+        plate.modDepthScale = drive.modDepthScale;
+        if (drive.lfoRate > 0.0f) {
+            plate.setLFORate(drive.lfoRate);
+        }
+
+        float plateL, plateR;
+        plate.process(drive.inL, drive.inR, decay, drive.damping, plateL, plateR);
+
+        processPost(mode, plateL, plateR, plate.lastTankOut[0], plate.lastTankOut[1],
+                    param1, param2, outL, outR);
+    }
+
+    // The two halves of process() around the plate step, for callers that run
+    // several voices through one DattorroPlate4 or drive the plate's block API.
+    // `tankL`/`tankR` are the plate's tank output of the previous sample in
+    // processPre and of the current one in processPost.
+    void processPre(int mode, float inL, float inR, float damping,
+                    float param1, float param2,
+                    float tankL, float tankR,
+                    PlateDrive& drive) {
+        drive.inL = inL;
+        drive.inR = inR;
+        drive.damping = damping;
+        drive.modDepthScale = 1.0f;
+        drive.lfoRate = 0.0f;
 
         switch (mode) {
             case MODE_FIELD_BLUR:
-                processFieldBlur(plate, inL, inR, decay, damping, param1, param2, outL, outR);
+                preFieldBlur(param1, param2, drive);
                 break;
             case MODE_AFTERIMAGE:
-                processAfterimage(plate, inL, inR, decay, damping, param1, param2, outL, outR);
+                // P1 gradually increases modulation (ghostly movement)
+                drive.lfoRate = 0.8f + param1 * 4.2f;
+                drive.modDepthScale = 1.0f + param1 * 4.0f;
                 break;
             case MODE_REVERSE:
-                processReverse(plate, inL, inR, decay, damping, param1, param2, outL, outR);
+                preReverse(param1, param2, tankL, tankR, drive);
                 break;
             case MODE_LOFI:
-                processLoFi(plate, inL, inR, decay, damping, param1, param2, outL, outR);
+                // Degradation darkens the tank as well
+                drive.damping = damping + (1.0f - damping) * param1 * 0.5f;
                 break;
             case MODE_MODULATED:
-                processModulated(plate, inL, inR, decay, damping, param1, param2, outL, outR);
+                drive.modDepthScale = 1.0f + param1 * 7.0f;
+                drive.lfoRate = 0.8f + param1 * 0.4f + param2 * 0.5f;
                 break;
             default:
                 // Fallback: clean plate
-                plate.modDepthScale = 1.0f;
-                plate.process(inL, inR, decay, damping, outL, outR);
+                break;
+        }
+    }
+
+    void processPost(int mode, float plateL, float plateR,
+                     float tankL, float tankR,
+                     float param1, float param2,
+                     float& outL, float& outR) {
+        switch (mode) {
+            case MODE_FIELD_BLUR:
+                postFieldBlur(plateL, plateR, tankL, tankR, param1, outL, outR);
+                break;
+            case MODE_AFTERIMAGE:
+                postAfterimage(plateL, plateR, param2, outL, outR);
+                break;
+            case MODE_REVERSE:
+                // Mix some direct reversed signal for immediacy
+                outL = plateL * 0.7f + reversedL * 0.3f;
+                outR = plateR * 0.7f + reversedR * 0.3f;
+                break;
+            case MODE_LOFI:
+                postLoFi(plateL, plateR, param1, param2, outL, outR);
+                break;
+            case MODE_MODULATED:
+                postModulated(plateL, plateR, param1, param2, outL, outR);
+                break;
+            default:
+                outL = plateL;
+                outR = plateR;
                 break;
         }
     }
@@ -146,12 +255,9 @@ private:
     // Each repeat cascades upward in pitch for ethereal shoegaze wash
     // P1 = Chorus Depth (ensemble thickness), P2 = Shimmer (regenerative)
     // ========================================================================
-    void processFieldBlur(DattorroPlate& plate, float inL, float inR,
-                          float decay, float damping,
-                          float chorusDepthParam, float shimmerLevel,
-                          float& outL, float& outR) {
+    void preFieldBlur(float chorusDepthParam, float shimmerLevel, PlateDrive& drive) {
         // Increased tank modulation for lush character
-        plate.modDepthScale = 1.0f + chorusDepthParam * 1.0f + shimmerLevel * 0.5f;
+        drive.modDepthScale = 1.0f + chorusDepthParam * 1.0f + shimmerLevel * 0.5f;
 
         // --- Regenerative shimmer: pitch-shift the TANK OUTPUT and feed back in ---
         // At P2=0: no shimmer feedback, just clean plate
@@ -168,16 +274,16 @@ private:
         shimmerSignal = rack::math::clamp(shimmerSignal, -1.0f, 1.0f);
 
         // Mix shimmer feedback into plate input
-        float plateInL = inL + shimmerSignal;
-        float plateInR = inR + shimmerSignal;
-
-        float plateL, plateR;
-        plate.process(plateInL, plateInR, decay, damping, plateL, plateR);
+        drive.inL += shimmerSignal;
+        drive.inR += shimmerSignal;
+    }
 
+    void postFieldBlur(float plateL, float plateR, float tankL, float tankR,
+                       float chorusDepthParam, float& outL, float& outR) {
         // Store normalized tank output for next sample's shimmer feedback
         // Use lastTankOut (pre-scaling) to avoid compounding the 1.4x output gain
-        shimmerFeedbackL = plate.lastTankOut[0];
-        shimmerFeedbackR = plate.lastTankOut[1];
+        shimmerFeedbackL = tankL;
+        shimmerFeedbackR = tankR;
 
         // --- Stereo chorus post-process (P1 controls depth/thickness) ---
         // At P1=0: clean stereo plate output
@@ -205,19 +311,10 @@ private:
     // Plate with resonant filter + pitch shift in feedback, deep modulation
     // P1 = Mod Rate, P2 = Diffusion (resonant filter Q)
     // ========================================================================
-    void processAfterimage(DattorroPlate& plate, float inL, float inR,
-                           float decay, float damping,
-                           float modRate, float diffusion,
-                           float& outL, float& outR) {
+    void postAfterimage(float plateL, float plateR, float diffusion,
+                        float& outL, float& outR) {
         // At P1=0, P2=0: clean plate with standard mod depth
-        // P1 gradually increases modulation (ghostly movement)
         // P2 adds spectral processing (resonant filter + pitch shift)
-        float lfoRate = 0.8f + modRate * 4.2f;
-        plate.setLFORate(lfoRate);
-        plate.modDepthScale = 1.0f + modRate * 4.0f;
-
-        float plateL, plateR;
-        plate.process(inL, inR, decay, damping, plateL, plateR);
 
         // At P2=0: output is 100% clean plate (no spectral processing)
         if (diffusion < 0.01f) {
@@ -268,30 +365,23 @@ private:
     // Input -> ReverseGrainBuffer -> Plate
     // P1 = Window Size, P2 = Feedback
     // ========================================================================
-    void processReverse(DattorroPlate& plate, float inL, float inR,
-                        float decay, float damping,
-                        float windowSize, float feedback,
-                        float& outL, float& outR) {
-        plate.modDepthScale = 1.0f;
-
+    void preReverse(float windowSize, float feedback, float tankL, float tankR,
+                    PlateDrive& drive) {
         // Set grain buffer window size
         reverseBufferL.setWindowSize(windowSize, sampleRate);
         reverseBufferR.setWindowSize(windowSize, sampleRate);
 
         // Feed input (+ feedback from plate output) into reverse buffer
         // Higher max feedback for self-oscillating reverse textures
-        float fbL = plate.lastTankOut[0] * feedback * 0.85f;
-        float fbR = plate.lastTankOut[1] * feedback * 0.85f;
+        float fbL = tankL * feedback * 0.85f;
+        float fbR = tankR * feedback * 0.85f;
 
-        float reversedL = reverseBufferL.process(inL + fbL);
-        float reversedR = reverseBufferR.process(inR + fbR);
+        reversedL = reverseBufferL.process(drive.inL + fbL);
+        reversedR = reverseBufferR.process(drive.inR + fbR);
 
         // Feed reversed signal into plate reverb
-        plate.process(reversedL, reversedR, decay, damping, outL, outR);
-
-        // Mix some direct reversed signal for immediacy
-        outL = outL * 0.7f + reversedL * 0.3f;
-        outR = outR * 0.7f + reversedR * 0.3f;
+        drive.inL = reversedL;
+        drive.inR = reversedR;
     }
 
     // ========================================================================
@@ -299,17 +389,8 @@ private:
     // Plate -> sample rate reduction -> saturation -> LP filter -> wow/flutter
     // P1 = Degradation, P2 = Wow/Flutter
     // ========================================================================
-    void processLoFi(DattorroPlate& plate, float inL, float inR,
-                     float decay, float damping,
-                     float degradation, float wowFlutter,
-                     float& outL, float& outR) {
-        // At P1=0, P2=0: clean plate
-        float lofidamping = damping + (1.0f - damping) * degradation * 0.5f;
-        plate.modDepthScale = 1.0f;
-
-        float plateL, plateR;
-        plate.process(inL, inR, decay, lofidamping, plateL, plateR);
-
+    void postLoFi(float plateL, float plateR, float degradation, float wowFlutter,
+                  float& outL, float& outR) {
         // At P1=0, P2=0: bypass all processing
         if (degradation < 0.01f && wowFlutter < 0.01f) {
             outL = plateL;
@@ -366,7 +447,6 @@ private:
             float ampMod = 1.0f + totalMod * 0.15f;
             outL *= ampMod;
             outR *= ampMod;
-            plate.modDepthScale = 1.0f + std::fabs(totalMod) * 2.0f;
         }
     }
 
@@ -375,17 +455,8 @@ private:
     // Plate with deep tank modulation + chorus post-process
     // P1 = Mod Depth, P2 = Detune
     // ========================================================================
-    void processModulated(DattorroPlate& plate, float inL, float inR,
-                          float decay, float damping,
-                          float modDepth, float detune,
-                          float& outL, float& outR) {
-        // At P1=0, P2=0: clean plate with standard mod depth
-        plate.modDepthScale = 1.0f + modDepth * 7.0f;
-        plate.setLFORate(0.8f + modDepth * 0.4f + detune * 0.5f);
-
-        float plateL, plateR;
-        plate.process(inL, inR, decay, damping, plateL, plateR);
-
+    void postModulated(float plateL, float plateR, float modDepth, float detune,
+                       float& outL, float& outR) {
         // At P1=0, P2=0: bypass chorus entirely (clean plate)
         float chorusAmount = modDepth * 0.4f + detune * 0.5f; // 0 to ~0.9
         if (chorusAmount < 0.01f) {
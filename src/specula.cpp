@@ -30,6 +30,10 @@ struct Specula : Module {
     dsp::VuMeter2 vuMeterRight;
     float leftNeedleDisplay = 0.f;
     float rightNeedleDisplay = 0.f;
+    // Meter ballistics run at control rate on the peak held since the last tick
+    shapetaker::dsp::ControlRateTicker meterTicker;
+    float leftPeakHold = 0.f;
+    float rightPeakHold = 0.f;
 
     Specula() {
         config(NUM_PARAMS, NUM_INPUTS, NUM_OUTPUTS, NUM_LIGHTS);
@@ -46,17 +50,23 @@ struct Specula : Module {
         passThroughAudio(LEFT_INPUT, LEFT_OUTPUT);
         passThroughAudio(RIGHT_INPUT, RIGHT_OUTPUT);
 
-        float leftPeak = getPeakVoltage(inputs[LEFT_INPUT]);
-        float rightPeak = getPeakVoltage(inputs[RIGHT_INPUT]);
+        leftPeakHold = std::max(leftPeakHold, getPeakVoltage(inputs[LEFT_INPUT]));
+        rightPeakHold = std::max(rightPeakHold, getPeakVoltage(inputs[RIGHT_INPUT]));
+        if (!meterTicker.tick(args.sampleTime)) {
+            return;
+        }
+        float meterTime = meterTicker.getElapsed();
 
         constexpr float calibration = 1.125f;
         float leftNeedle = computeNeedleNormalized(
-            args.sampleTime, leftPeak, calibration, vuMeterLeft);
+            meterTime, leftPeakHold, calibration, vuMeterLeft);
         float rightNeedle = computeNeedleNormalized(
-            args.sampleTime, rightPeak, calibration, vuMeterRight);
+            meterTime, rightPeakHold, calibration, vuMeterRight);
+        leftPeakHold = 0.f;
+        rightPeakHold = 0.f;
 
-        lights[LEFT_VU_LIGHT].setBrightness(applyNeedleBallistics(args.sampleTime, leftNeedle, leftNeedleDisplay));
-        lights[RIGHT_VU_LIGHT].setBrightness(applyNeedleBallistics(args.sampleTime, rightNeedle, rightNeedleDisplay));
+        lights[LEFT_VU_LIGHT].setBrightness(applyNeedleBallistics(meterTime, leftNeedle, leftNeedleDisplay));
+        lights[RIGHT_VU_LIGHT].setBrightness(applyNeedleBallistics(meterTime, rightNeedle, rightNeedleDisplay));
     }
 
 private:
@@ -33,6 +33,7 @@ namespace tessellation {
     constexpr float MOD_RATE_MIN_HZ = 0.1f;
     constexpr float MOD_RATE_RANGE_HZ = 4.9f;
     constexpr float STEREO_MOD_OFFSET_SECONDS = 0.00075f;
+    constexpr float SLEEP_TAIL_MARGIN_SECONDS = 0.05f;
 
     inline float subdivisionMultiplier(int index) {
         switch (index) {
@@ -170,58 +171,105 @@ struct Tessellation : Module {
         PingPongInverted = 2
     };
 
+    // Fractional delay read. Hermite keeps modulated repeats from dulling
+    // (linear interpolation is a moving lowpass) at about twice the reads.
+    enum class Interpolation {
+        Linear = 0,
+        Hermite = 1
+    };
+
+    /**
+     * Three of these run per module, six channels each. Buffers are
+     * power-of-two rings with the channels interleaved per frame, so wrapping
+     * is a mask and a frame's writes land in one cache line.
+     *
+     * The read side (delay smoothing, LFO, fractional read, tone, voicing)
+     * only depends on what is already in the ring, so renderBlock() computes
+     * it for BLOCK_FRAMES frames ahead, vectorized across channels. Writes
+     * need the current input (feedback, cross-feedback) and stay per frame:
+     * read the taps, write(), then advance(). Keeping every read at least
+     * BLOCK_FRAMES + 2 samples behind the write head makes this identical to
+     * per-sample processing, with no added latency.
+     */
     struct StereoDelayLine {
         static constexpr int MAX_CHANNELS = 6;
+        static constexpr int LANES = 8;          // MAX_CHANNELS rounded up to float_4 groups
+        static constexpr int BLOCK_FRAMES = 16;
+        // Hermite reads one sample newer than the integer delay
+        static constexpr float MIN_READ_DELAY = BLOCK_FRAMES + 2.f;
 
         float sampleRate = 44100.f;
-        int bufferSize = 1;
-        std::array<std::vector<float>, MAX_CHANNELS> bufferL;
-        std::array<std::vector<float>, MAX_CHANNELS> bufferR;
-        std::array<size_t, MAX_CHANNELS> writeIndex{};
-        std::array<float, MAX_CHANNELS> delaySamples{};
-        std::array<float, MAX_CHANNELS> targetDelaySamples{};  // Target delay time for smoothing
-        std::array<float, MAX_CHANNELS> toneStateL{};
-        std::array<float, MAX_CHANNELS> toneStateR{};
-        std::array<float, MAX_CHANNELS> modPhase{};
+        int bufferSize = 1;                      // frames, power of two
+        int bufferMask = 0;
+        std::vector<float> bufferL;              // [frame * MAX_CHANNELS + channel]
+        std::vector<float> bufferR;
+        int writeIndex = 0;
+        alignas(16) std::array<float, LANES> delaySamples{};
+        alignas(16) std::array<float, LANES> targetDelaySamples{};  // Target delay time for smoothing
+        alignas(16) std::array<float, LANES> toneStateL{};
+        alignas(16) std::array<float, LANES> toneStateR{};
+        // Control-rate modulation, per channel: each channel keeps its own
+        // LFO phase, last value and countdown to the next update
+        alignas(16) std::array<float, LANES> modPhase{};
+        alignas(16) std::array<float, LANES> modSamples{};
+        alignas(16) std::array<float, LANES> lfoCountdown{};
         VoiceType voice = VoiceType::Voice24_96;
+        Interpolation interpolation = Interpolation::Linear;
         float enginePhaseOffset = 0.f;
         PingPongMode pingPongMode = PingPongMode::Off;
         float smoothingCoeff = 0.9995f;  // Smoothing coefficient for delay time changes
+        float stereoOffsetSamples = 0.f;
 
-        // Tone filter coefficient cache
+        // Tone filter coefficient cache (per line)
         float cachedTone = -1.f;
         float cachedAlpha = 0.f;
         float cachedTilt = 0.f;
 
-        // LFO decimation for modulation (optimization: update every N samples)
-        int lfoDecimationCounter = 0;
-        static constexpr int kLfoDecimation = 8;  // Update every 8 samples
-        float cachedModSamples = 0.f;
-        float cachedStereoOffsetSampleRate = -1.f;
-        float cachedStereoOffset = 0.f;
+        // LFO decimation for modulation (optimization: update every N frames)
+        static constexpr int kLfoDecimation = 8;  // Update every 8 frames
+
+        // Rendered read side: taps for blockFrames frames starting at the write head
+        alignas(16) float tapL[BLOCK_FRAMES][LANES] = {};
+        alignas(16) float tapR[BLOCK_FRAMES][LANES] = {};
+        int blockFrames = 0;
+        int blockPos = 0;
+        // LFO settings the current block was rendered with
+        bool blockLfoRunning = false;
+        float blockLfoStep = 0.f;
+        float blockDepthSamples = 0.f;
 
         void init(float sr, float phaseOffset = 0.f) {
             sampleRate = std::max(sr, 1.f);
-            bufferSize = std::max(2, static_cast<int>(std::ceil(tessellation::MAX_DELAY_SECONDS * sampleRate)) + 2);
-            for (int ch = 0; ch < MAX_CHANNELS; ++ch) {
-                bufferL[ch].assign(bufferSize, 0.f);
-                bufferR[ch].assign(bufferSize, 0.f);
+            int minFrames = std::max(2, static_cast<int>(std::ceil(tessellation::MAX_DELAY_SECONDS * sampleRate)) + 2);
+            bufferSize = 1;
+            while (bufferSize < minFrames) {
+                bufferSize <<= 1;
             }
-            writeIndex.fill(0);
+            bufferMask = bufferSize - 1;
+            bufferL.assign(static_cast<size_t>(bufferSize) * MAX_CHANNELS, 0.f);
+            bufferR.assign(static_cast<size_t>(bufferSize) * MAX_CHANNELS, 0.f);
+            writeIndex = 0;
             toneStateL.fill(0.f);
             toneStateR.fill(0.f);
             modPhase.fill(rack::math::clamp(phaseOffset, 0.f, 1.f));
+            modSamples.fill(0.f);
+            lfoCountdown.fill(0.f);
             enginePhaseOffset = phaseOffset;
             float defaultSamples = tessellation::DEFAULT_DELAY_SECONDS * sampleRate;
             delaySamples.fill(defaultSamples);
             targetDelaySamples.fill(defaultSamples);
-            cachedStereoOffsetSampleRate = sampleRate;
-            cachedStereoOffset = sampleRate * tessellation::STEREO_MOD_OFFSET_SECONDS;
+            stereoOffsetSamples = sampleRate * tessellation::STEREO_MOD_OFFSET_SECONDS;
+            cachedTone = -1.f;
+            invalidateBlock();
+        }
+
+        float maxDelaySamples() const {
+            return static_cast<float>(bufferSize - 2);
         }
 
         void setDelaySeconds(int channel, float seconds) {
             channel = rack::math::clamp(channel, 0, MAX_CHANNELS - 1);
-            float samples = rack::math::clamp(seconds * sampleRate, 1.f, static_cast<float>(bufferSize - 2));
+            float samples = rack::math::clamp(seconds * sampleRate, 1.f, maxDelaySamples());
             targetDelaySamples[channel] = samples;  // Set target instead of directly changing delay
         }
 
@@ -233,82 +281,68 @@ struct Tessellation : Module {
             pingPongMode = static_cast<PingPongMode>(rack::math::clamp(mode, 0, tessellation::MODE_MAX_INDEX));
         }
 
+        void setInterpolation(int mode) {
+            interpolation = static_cast<Interpolation>(rack::math::clamp(mode, 0, 1));
+        }
+
         void resetChannel(int channel, float delaySeconds) {
             channel = rack::math::clamp(channel, 0, MAX_CHANNELS - 1);
-            std::fill(bufferL[channel].begin(), bufferL[channel].end(), 0.f);
-            std::fill(bufferR[channel].begin(), bufferR[channel].end(), 0.f);
+            for (size_t i = channel; i < bufferL.size(); i += MAX_CHANNELS) {
+                bufferL[i] = 0.f;
+                bufferR[i] = 0.f;
+            }
             toneStateL[channel] = 0.f;
             toneStateR[channel] = 0.f;
             modPhase[channel] = enginePhaseOffset;
-            writeIndex[channel] = 0;
-            float samples = rack::math::clamp(delaySeconds * sampleRate, 1.f, static_cast<float>(bufferSize - 2));
+            lfoCountdown[channel] = 0.f;  // Fresh LFO value on the next frame
+            float samples = rack::math::clamp(delaySeconds * sampleRate, 1.f, maxDelaySamples());
             delaySamples[channel] = samples;
             targetDelaySamples[channel] = samples;
+            finishBlockSilent(channel);
         }
 
-        struct Result {
-            float wetL = 0.f;
-            float wetR = 0.f;
-            float tapL = 0.f;
-            float tapR = 0.f;
-        };
-
-        Result process(int channel, float inL, float inR, float feedback, float tone,
-                        float modDepthSeconds, float modRateHz, float sampleTime) {
-            channel = rack::math::clamp(channel, 0, MAX_CHANNELS - 1);
-
-            // Smooth delay time changes to avoid artifacts when modulating
-            delaySamples[channel] = delaySamples[channel] * smoothingCoeff +
-                                    targetDelaySamples[channel] * (1.f - smoothingCoeff);
-
-            float depthSamples = rack::math::clamp(modDepthSeconds * sampleRate, 0.f, static_cast<float>(bufferSize) * 0.45f);
-            float phase = modPhase[channel];
-
-            // Optimization: Decimate LFO calculation (update every N samples)
-            // LFO rates are slow (0.1-5 Hz), so we don't need sample-accurate modulation
-            if (lfoDecimationCounter == 0) {
-                if (depthSamples > 0.f && modRateHz > 0.f) {
-                    phase += modRateHz * sampleTime * kLfoDecimation;
-                    // Optimize phase wrapping: simple subtraction instead of floor()
-                    if (phase >= 1.f) {
-                        phase -= 1.f;
+        // The other channels keep their rendered taps, so a reset takes effect
+        // at the next block boundary. Until then the reset channel plays what
+        // per-sample processing would: its ring is empty and every read sits
+        // at least MIN_READ_DELAY behind the write head, so its taps are zero.
+        // Its delay smoothing and LFO still run over those frames.
+        void finishBlockSilent(int channel) {
+            for (int k = blockPos; k < blockFrames; ++k) {
+                delaySamples[channel] = delaySamples[channel] * smoothingCoeff +
+                                        targetDelaySamples[channel] * (1.f - smoothingCoeff);
+                if (lfoCountdown[channel] <= 0.f) {
+                    if (blockLfoRunning) {
+                        float advanced = modPhase[channel] + blockLfoStep;
+                        modPhase[channel] = advanced >= 1.f ? advanced - 1.f : advanced;
                     }
+                    float lfoPhase = modPhase[channel] + enginePhaseOffset;
+                    lfoPhase = lfoPhase >= 1.f ? lfoPhase - 1.f : lfoPhase;
+                    // Same sin as renderBlock(), so the lane matches bit for bit
+                    float lfo = simd::sin(simd::float_4(tessellation::TWO_PI * lfoPhase))[0];
+                    modSamples[channel] = lfo * blockDepthSamples;
+                    lfoCountdown[channel] = kLfoDecimation - 1.f;
+                } else {
+                    lfoCountdown[channel] -= 1.f;
                 }
-                modPhase[channel] = phase;
-                float lfoPhase = phase + enginePhaseOffset;
-                // Optimize phase wrapping: simple subtraction instead of floor()
-                if (lfoPhase >= 1.f) {
-                    lfoPhase -= 1.f;
-                }
-                cachedModSamples = std::sin(tessellation::TWO_PI * lfoPhase) * depthSamples;
+                tapL[k][channel] = 0.f;
+                tapR[k][channel] = 0.f;
             }
+        }
 
-            float modSamples = cachedModSamples;
-            if (sampleRate != cachedStereoOffsetSampleRate) {
-                cachedStereoOffsetSampleRate = sampleRate;
-                cachedStereoOffset = sampleRate * tessellation::STEREO_MOD_OFFSET_SECONDS;
-            }
-            float delaySamplesL = rack::math::clamp(delaySamples[channel] + modSamples - cachedStereoOffset, 1.f,
-                static_cast<float>(bufferSize - 2));
-            float delaySamplesR = rack::math::clamp(delaySamples[channel] - modSamples + cachedStereoOffset, 1.f,
-                static_cast<float>(bufferSize - 2));
-
-            auto readSample = [&](std::vector<float>& buffer, float delaySamples) {
-                float readIndex = static_cast<float>(writeIndex[channel]) - delaySamples;
-                while (readIndex < 0.f) {
-                    readIndex += bufferSize;
-                }
-                size_t index0 = static_cast<size_t>(readIndex) % bufferSize;
-                size_t index1 = (index0 + 1) % bufferSize;
-                float frac = readIndex - std::floor(readIndex);
-                return rack::math::crossfade(buffer[index0], buffer[index1], rack::math::clamp(frac, 0.f, 1.f));
-            };
+        void invalidateBlock() {
+            blockFrames = 0;
+            blockPos = 0;
+        }
 
-            float delayedL = readSample(bufferL[channel], delaySamplesL);
-            float delayedR = readSample(bufferR[channel], delaySamplesR);
+        bool needsRender() const {
+            return blockPos >= blockFrames;
+        }
 
-            tone = rack::math::clamp(tone, 0.f, 1.f);
+        // Computes the next BLOCK_FRAMES frames of taps for the first `channels` channels
+        void renderBlock(int channels, float tone, float modDepthSeconds, float modRateHz, float sampleTime) {
+            using simd::float_4;
 
+            tone = rack::math::clamp(tone, 0.f, 1.f);
             // Cache tone filter coefficients to avoid repeated exp() calls
             if (tone != cachedTone) {
                 cachedTone = tone;
@@ -318,59 +352,186 @@ struct Tessellation : Module {
                 cachedTilt = tone * 2.f - 1.f;
             }
 
-            float& lowL = toneStateL[channel];
-            float& lowR = toneStateR[channel];
-            lowL = rack::math::crossfade(delayedL, lowL, cachedAlpha);
-            lowR = rack::math::crossfade(delayedR, lowR, cachedAlpha);
-            float highL = delayedL - lowL;
-            float highR = delayedR - lowR;
-            float tonedL = (cachedTilt <= 0.f)
-                ? rack::math::crossfade(delayedL, lowL, -cachedTilt)
-                : rack::math::crossfade(delayedL, highL, cachedTilt);
-            float tonedR = (cachedTilt <= 0.f)
-                ? rack::math::crossfade(delayedR, lowR, -cachedTilt)
-                : rack::math::crossfade(delayedR, highR, cachedTilt);
-
-            applyVoicing(tonedL, tonedR);
+            float depthSamples = rack::math::clamp(modDepthSeconds * sampleRate, 0.f, static_cast<float>(bufferSize) * 0.45f);
+            bool lfoRunning = depthSamples > 0.f && modRateHz > 0.f;
+            float lfoStep = modRateHz * sampleTime * kLfoDecimation;
+            blockLfoRunning = lfoRunning;
+            blockLfoStep = lfoStep;
+            blockDepthSamples = depthSamples;
+
+            const float_4 smoothing = smoothingCoeff;
+            const float_4 alpha = cachedAlpha;
+            const float_4 offset = stereoOffsetSamples;
+            const float_4 minDelay = MIN_READ_DELAY;
+            const float_4 maxDelay = maxDelaySamples();
+            const bool tiltDark = cachedTilt <= 0.f;
+            const float_4 tiltAmount = tiltDark ? -cachedTilt : cachedTilt;
+
+            int groups = (rack::math::clamp(channels, 1, MAX_CHANNELS) + 3) / 4;
+            for (int g = 0; g < groups; ++g) {
+                const int base = g * 4;
+                const int lanes = std::min(4, MAX_CHANNELS - base);
+                float_4 delay = float_4::load(&delaySamples[base]);
+                float_4 target = float_4::load(&targetDelaySamples[base]);
+                float_4 phase = float_4::load(&modPhase[base]);
+                float_4 mod = float_4::load(&modSamples[base]);
+                float_4 lowL = float_4::load(&toneStateL[base]);
+                float_4 lowR = float_4::load(&toneStateR[base]);
+                float_4 countdown = float_4::load(&lfoCountdown[base]);
+
+                for (int k = 0; k < BLOCK_FRAMES; ++k) {
+                    // Smooth delay time changes to avoid artifacts when modulating
+                    delay = delay * smoothing + target * (1.f - smoothing);
+
+                    // LFO rates are slow (0.1-5 Hz), so control rate is plenty
+                    float_4 due = countdown <= 0.f;
+                    if (simd::movemask(due)) {
+                        if (lfoRunning) {
+                            float_4 advanced = phase + lfoStep;
+                            advanced = simd::ifelse(advanced >= 1.f, advanced - 1.f, advanced);
+                            phase = simd::ifelse(due, advanced, phase);
+                        }
+                        float_4 lfoPhase = phase + enginePhaseOffset;
+                        lfoPhase = simd::ifelse(lfoPhase >= 1.f, lfoPhase - 1.f, lfoPhase);
+                        mod = simd::ifelse(due, simd::sin(tessellation::TWO_PI * lfoPhase) * depthSamples, mod);
+                    }
+                    countdown = simd::ifelse(due, float_4(kLfoDecimation - 1.f), countdown - 1.f);
+
+                    float_4 delayL = simd::clamp(delay + mod - offset, minDelay, maxDelay);
+                    float_4 delayR = simd::clamp(delay - mod + offset, minDelay, maxDelay);
+                    float_4 delayedL, delayedR;
+                    if (interpolation == Interpolation::Hermite) {
+                        delayedL = readFrameHermite(bufferL, k, base, lanes, delayL);
+                        delayedR = readFrameHermite(bufferR, k, base, lanes, delayR);
+                    } else {
+                        delayedL = readFrame(bufferL, k, base, lanes, delayL);
+                        delayedR = readFrame(bufferR, k, base, lanes, delayR);
+                    }
+
+                    lowL = delayedL + (lowL - delayedL) * alpha;
+                    lowR = delayedR + (lowR - delayedR) * alpha;
+                    float_4 tonedL = tiltDark
+                        ? delayedL + (lowL - delayedL) * tiltAmount
+                        : delayedL - lowL * tiltAmount;
+                    float_4 tonedR = tiltDark
+                        ? delayedR + (lowR - delayedR) * tiltAmount
+                        : delayedR - lowR * tiltAmount;
+
+                    applyVoicing(tonedL, tonedR);
+                    tonedL.store(&tapL[k][base]);
+                    tonedR.store(&tapR[k][base]);
+                }
+
+                delay.store(&delaySamples[base]);
+                phase.store(&modPhase[base]);
+                mod.store(&modSamples[base]);
+                lowL.store(&toneStateL[base]);
+                lowR.store(&toneStateR[base]);
+                countdown.store(&lfoCountdown[base]);
+            }
+
+            blockFrames = BLOCK_FRAMES;
+            blockPos = 0;
+        }
+
+        // Linear fractional read of frame `k` of the block, one lane per channel
+        simd::float_4 readFrame(const std::vector<float>& buffer, int k, int base, int lanes,
+                                simd::float_4 delay) const {
+            simd::float_4 whole = simd::floor(delay);
+            simd::float_4 frac = delay - whole;
+            alignas(16) float wholeLanes[4];
+            alignas(16) float older[4] = {};
+            alignas(16) float newer[4] = {};
+            whole.store(wholeLanes);
+            const float* data = buffer.data();
+            for (int lane = 0; lane < lanes; ++lane) {
+                int index = (writeIndex + k - static_cast<int>(wholeLanes[lane])) & bufferMask;
+                newer[lane] = data[index * MAX_CHANNELS + base + lane];
+                older[lane] = data[((index - 1) & bufferMask) * MAX_CHANNELS + base + lane];
+            }
+            simd::float_4 b = simd::float_4::load(newer);
+            return b + (simd::float_4::load(older) - b) * frac;
+        }
 
+        // 4-point, 3rd-order Hermite read between the same two samples as readFrame()
+        simd::float_4 readFrameHermite(const std::vector<float>& buffer, int k, int base, int lanes,
+                                       simd::float_4 delay) const {
+            simd::float_4 whole = simd::floor(delay);
+            simd::float_4 t = delay - whole;
+            alignas(16) float wholeLanes[4];
+            alignas(16) float points[4][4] = {};  // [newest .. oldest][lane]
+            whole.store(wholeLanes);
+            const float* data = buffer.data();
+            for (int lane = 0; lane < lanes; ++lane) {
+                int index = (writeIndex + k - static_cast<int>(wholeLanes[lane]) + 1) & bufferMask;
+                for (int p = 0; p < 4; ++p) {
+                    points[p][lane] = data[((index - p) & bufferMask) * MAX_CHANNELS + base + lane];
+                }
+            }
+            simd::float_4 p0 = simd::float_4::load(points[0]);
+            simd::float_4 p1 = simd::float_4::load(points[1]);
+            simd::float_4 p2 = simd::float_4::load(points[2]);
+            simd::float_4 p3 = simd::float_4::load(points[3]);
+            simd::float_4 c1 = 0.5f * (p2 - p0);
+            simd::float_4 c2 = p0 - 2.5f * p1 + 2.f * p2 - 0.5f * p3;
+            simd::float_4 c3 = 0.5f * (p3 - p0) + 1.5f * (p1 - p2);
+            return ((c3 * t + c2) * t + c1) * t + p1;
+        }
+
+        struct Result {
+            float wetL = 0.f;
+            float wetR = 0.f;
+            float tapL = 0.f;
+            float tapR = 0.f;
+        };
+
+        // Taps for the current frame; renderBlock() must have run
+        Result read(int channel) const {
+            channel = rack::math::clamp(channel, 0, MAX_CHANNELS - 1);
             Result res;
-            res.tapL = tonedL;
-            res.tapR = tonedR;
+            res.tapL = tapL[blockPos][channel];
+            res.tapR = tapR[blockPos][channel];
 
             // Apply ping-pong routing if enabled
             // Normal: L→L, R→R
             // PingPong: L→R, R→L (delays bounce between channels)
             // PingPongInverted: R→L, L→R (reverse phase)
             if (pingPongMode == PingPongMode::PingPong) {
-                res.wetL = tonedR;
-                res.wetR = tonedL;
+                res.wetL = res.tapR;
+                res.wetR = res.tapL;
             } else if (pingPongMode == PingPongMode::PingPongInverted) {
-                res.wetL = tonedL;
-                res.wetR = tonedR;
+                res.wetL = res.tapL;
+                res.wetR = res.tapR;
             } else {
-                res.wetL = tonedL;
-                res.wetR = tonedR;
+                res.wetL = res.tapL;
+                res.wetR = res.tapR;
             }
+            return res;
+        }
 
-            float writeL = rack::math::clamp(tonedL * feedback + inL, -10.f, 10.f);
-            float writeR = rack::math::clamp(tonedR * feedback + inR, -10.f, 10.f);
-
-            bufferL[channel][writeIndex[channel]] = writeL;
-            bufferR[channel][writeIndex[channel]] = writeR;
-            writeIndex[channel] = (writeIndex[channel] + 1) % bufferSize;
-
-            // Increment LFO decimation counter
-            lfoDecimationCounter = (lfoDecimationCounter + 1) % kLfoDecimation;
+        void write(int channel, const Result& res, float inL, float inR, float feedback) {
+            channel = rack::math::clamp(channel, 0, MAX_CHANNELS - 1);
+            size_t index = static_cast<size_t>(writeIndex) * MAX_CHANNELS + channel;
+            bufferL[index] = rack::math::clamp(res.tapL * feedback + inL, -10.f, 10.f);
+            bufferR[index] = rack::math::clamp(res.tapR * feedback + inR, -10.f, 10.f);
+        }
 
-            return res;
+        // Moves the write head once every active channel has been written
+        void advance() {
+            writeIndex = (writeIndex + 1) & bufferMask;
+            blockPos++;
         }
 
-        void applyVoicing(float& left, float& right) const {
+        void applyVoicing(simd::float_4& left, simd::float_4& right) const {
             switch (voice) {
                 case VoiceType::VoiceADM: {
-                    auto adm = [](float x) {
-                        float driven = std::tanh(x * 1.6f);
-                        return 0.65f * x + 0.35f * driven;
+                    auto adm = [](simd::float_4 x) {
+                        alignas(16) float lanes[4];
+                        (x * 1.6f).store(lanes);
+                        for (float& lane : lanes) {
+                            lane = std::tanh(lane);
+                        }
+                        return 0.65f * x + 0.35f * simd::float_4::load(lanes);
                     };
                     left = adm(left);
                     right = adm(right);
@@ -379,9 +540,9 @@ struct Tessellation : Module {
                 case VoiceType::Voice12Bit: {
                     constexpr float fullScale = 10.f; // ±5 V audio range
                     constexpr float step = fullScale / 4096.f; // 12-bit quantization
-                    auto quantize = [](float sample) {
-                        float clamped = rack::math::clamp(sample, -5.f, 5.f);
-                        return std::round(clamped / step) * step;
+                    auto quantize = [](simd::float_4 sample) {
+                        simd::float_4 clamped = simd::clamp(sample, -5.f, 5.f);
+                        return simd::round(clamped / step) * step;
                     };
                     left = quantize(left);
                     right = quantize(right);
@@ -430,6 +591,7 @@ struct Tessellation : Module {
     float cachedMix2 = 0.45f;
     float cachedMix3 = 0.45f;
     float cachedModDepthSeconds = 0.002f;
+    shapetaker::dsp::ControlRateTicker lightTicker;
     float cachedModRateHz = 1.57f;
     float cachedCrossFeedback = 0.0f;
     // Input de-click
@@ -442,6 +604,11 @@ struct Tessellation : Module {
     int cachedVoice3 = 2;
     int cachedPingPongMode = 0;
     int activeChannels = 1;
+    // Per delay line fractional read (Interpolation), chosen from the context menu
+    std::array<int, tessellation::NUM_DELAYS> interpolationModes{};
+    // Context menu: stop running the delay lines once input and repeats are silent
+    bool sleepWhenSilent = true;
+    shapetaker::dsp::SilenceSleep silence;
 
     void initDelayLines(float sr) {
         sampleRate = sr;
@@ -526,6 +693,33 @@ struct Tessellation : Module {
         initDelayLines(sr);
     }
 
+    json_t* dataToJson() override {
+        json_t* rootJ = json_object();
+        json_t* interpolationJ = json_array();
+        for (int mode : interpolationModes) {
+            json_array_append_new(interpolationJ, json_integer(mode));
+        }
+        json_object_set_new(rootJ, "interpolation", interpolationJ);
+        json_object_set_new(rootJ, "sleepWhenSilent", json_boolean(sleepWhenSilent));
+        return rootJ;
+    }
+
+    void dataFromJson(json_t* rootJ) override {
+        json_t* interpolationJ = json_object_get(rootJ, "interpolation");
+        if (interpolationJ) {
+            for (int i = 0; i < tessellation::NUM_DELAYS; ++i) {
+                json_t* modeJ = json_array_get(interpolationJ, i);
+                if (modeJ) {
+                    interpolationModes[i] = rack::math::clamp((int)json_integer_value(modeJ), 0, 1);
+                }
+            }
+        }
+        json_t* sleepJ = json_object_get(rootJ, "sleepWhenSilent");
+        if (sleepJ) {
+            sleepWhenSilent = json_boolean_value(sleepJ);
+        }
+    }
+
     void process(const ProcessArgs& args) override {
         sampleRate = args.sampleRate;
 
@@ -636,6 +830,7 @@ struct Tessellation : Module {
         for (int i = 0; i < tessellation::NUM_DELAYS; ++i) {
             delayLines[i].setVoice(cachedVoices[i]);
             delayLines[i].setPingPong(cachedPingPongMode);
+            delayLines[i].setInterpolation(interpolationModes[i]);
         }
 
         auto resetChannelState = [&](int c) {
@@ -700,6 +895,26 @@ struct Tessellation : Module {
             outputs[DELAY1_OUTPUT + i].setChannels(channels);
         }
 
+        // A repeat can sit in a line for the longest delay time before it
+        // shows up at a tap, so silence has to last that long
+        float inputPeak = std::max(shapetaker::dsp::portPeak(inputs[IN_L_INPUT]),
+                                   shapetaker::dsp::portPeak(inputs[IN_R_INPUT]));
+        float longestDelay = std::max(cachedDelay1Seconds, std::max(cachedDelay2Seconds, cachedDelay3Seconds));
+        silence.setEnabled(sleepWhenSilent);
+        silence.setTailSeconds(longestDelay + cachedModDepthSeconds + tessellation::SLEEP_TAIL_MARGIN_SECONDS);
+        if (silence.asleep(inputPeak)) {
+            // Buffers, write heads and render blocks stay put until input returns
+            for (int c = 0; c < channels; ++c) {
+                outputs[OUT_L_OUTPUT].setVoltage(0.f, c);
+                outputs[OUT_R_OUTPUT].setVoltage(0.f, c);
+                for (int i = 0; i < tessellation::NUM_DELAYS; ++i) {
+                    outputs[DELAY1_OUTPUT + i].setVoltage(0.f, c);
+                }
+            }
+            updateLights(args);
+            return;
+        }
+
         float wetGainComp = 1.f / std::max(1.f, cachedMix1 + cachedMix2 + cachedMix3);
         wetGainComp = rack::math::clamp(wetGainComp, 0.5f, 1.f);
         float dryFactor = 1.f;
@@ -721,6 +936,17 @@ struct Tessellation : Module {
             return (res.tapL + res.tapR) * 0.5f;
         };
 
+        for (int i = 0; i < tessellation::NUM_DELAYS; ++i) {
+            for (int c = 0; c < channels; ++c) {
+                delayLines[i].setDelaySeconds(c, cachedDelays[i]);
+            }
+            if (delayLines[i].needsRender()) {
+                delayLines[i].renderBlock(channels, cachedTone[i],
+                    cachedModDepthSeconds, cachedModRateHz, args.sampleTime);
+            }
+        }
+
+        float tailPeak = inputPeak;
         for (int c = 0; c < channels; ++c) {
             float inL = (lChannels > 0) ? inputs[IN_L_INPUT].getVoltage(c % lChannels) : 0.f;
             float inR;
@@ -734,44 +960,40 @@ struct Tessellation : Module {
             inL *= leftGain;
             inR *= rightGain;
 
+            // Taps only depend on the buffers, so all three are known before any write
+            std::array<StereoDelayLine::Result, tessellation::NUM_DELAYS> results;
             for (int i = 0; i < tessellation::NUM_DELAYS; ++i) {
-                delayLines[i].setDelaySeconds(c, cachedDelays[i]);
+                results[i] = delayLines[i].read(c);
+                tailPeak = std::max(tailPeak, std::max(std::fabs(results[i].tapL), std::fabs(results[i].tapR)));
             }
 
             // Optimization: Conditional cross-feedback processing
             // When crossFeedback is zero, skip the multiplication operations
-            std::array<StereoDelayLine::Result, tessellation::NUM_DELAYS> results;
-
             if (cachedCrossFeedback > 0.f) {
                 // Cross-feedback matrix: Delay 1 → 2 → 3 → 1 (circular)
-                // Process delays sequentially to implement cross-feedback routing
 
                 // Delay 1 gets input + cross-fed signal from Delay 3 (previous sample)
                 float in1L = inL + xfeedDelay3L[c] * cachedCrossFeedback;
                 float in1R = inR + xfeedDelay3R[c] * cachedCrossFeedback;
-                results[0] = delayLines[0].process(c, in1L, in1R, cachedFeedback[0], cachedTone[0],
-                    cachedModDepthSeconds, cachedModRateHz, args.sampleTime);
+                delayLines[0].write(c, results[0], in1L, in1R, cachedFeedback[0]);
 
                 // Delay 2 gets input + cross-fed signal from Delay 1
                 float in2L = inL + results[0].tapL * cachedCrossFeedback;
                 float in2R = inR + results[0].tapR * cachedCrossFeedback;
-                results[1] = delayLines[1].process(c, in2L, in2R, cachedFeedback[1], cachedTone[1],
-                    cachedModDepthSeconds, cachedModRateHz, args.sampleTime);
+                delayLines[1].write(c, results[1], in2L, in2R, cachedFeedback[1]);
 
                 // Delay 3 gets input + cross-fed signal from Delay 2
                 float in3L = inL + results[1].tapL * cachedCrossFeedback;
                 float in3R = inR + results[1].tapR * cachedCrossFeedback;
-                results[2] = delayLines[2].process(c, in3L, in3R, cachedFeedback[2], cachedTone[2],
-                    cachedModDepthSeconds, cachedModRateHz, args.sampleTime);
+                delayLines[2].write(c, results[2], in3L, in3R, cachedFeedback[2]);
 
                 // Store Delay 3 output for next sample's Delay 1 feedback
                 xfeedDelay3L[c] = results[2].tapL;
                 xfeedDelay3R[c] = results[2].tapR;
             } else {
-                // No cross-feedback: process delays independently (faster)
+                // No cross-feedback: write delays independently (faster)
                 for (int i = 0; i < tessellation::NUM_DELAYS; ++i) {
-                    results[i] = delayLines[i].process(c, inL, inR, cachedFeedback[i], cachedTone[i],
-                        cachedModDepthSeconds, cachedModRateHz, args.sampleTime);
+                    delayLines[i].write(c, results[i], inL, inR, cachedFeedback[i]);
                 }
             }
 
@@ -795,7 +1017,16 @@ struct Tessellation : Module {
                 outputs[DELAY1_OUTPUT + i].setVoltage(send, c);
             }
         }
+        for (int i = 0; i < tessellation::NUM_DELAYS; ++i) {
+            delayLines[i].advance();
+        }
+        silence.observe(tailPeak, args.sampleTime);
 
+        updateLights(args);
+    }
+
+    // Delay LED pulses keep time while the module sleeps
+    void updateLights(const ProcessArgs& args) {
         // Track each delay's phase for LED pulsing
         // Pulse duration scales with delay time: shorter delays = shorter pulses
         auto tickDelayPulse = [&](float& phase, float periodSeconds, rack::dsp::PulseGenerator& pulse, bool enabled) {
@@ -815,6 +1046,11 @@ struct Tessellation : Module {
         tickDelayPulse(delay2Phase, cachedDelay2Seconds, delay2Pulse, true);
         tickDelayPulse(delay3Phase, cachedDelay3Seconds, delay3Pulse, true);
 
+        if (!lightTicker.tick(args.sampleTime)) {
+            return;
+        }
+        float lightTime = lightTicker.getElapsed();
+
         // Tempo light: Light up when tap button is pressed
         float tapPressed = params[TAP_PARAM].getValue();
         lights[TEMPO_LIGHT + 0].setBrightness(tapPressed);
@@ -831,24 +1067,24 @@ struct Tessellation : Module {
         float mix3Led = mixBrightness(cachedMix3);
 
         // LEDs only light up when pulsing, brightness scaled by mix level
-        float bright1 = delay1Pulse.process(args.sampleTime) ? mix1Led : 0.f;
-        float bright2 = delay2Pulse.process(args.sampleTime) ? mix2Led : 0.f;
-        float bright3 = delay3Pulse.process(args.sampleTime) ? mix3Led : 0.f;
+        float bright1 = delay1Pulse.process(lightTime) ? mix1Led : 0.f;
+        float bright2 = delay2Pulse.process(lightTime) ? mix2Led : 0.f;
+        float bright3 = delay3Pulse.process(lightTime) ? mix3Led : 0.f;
 
         // Mix 1: Teal
-        lights[MIX1_LIGHT + 0].setBrightnessSmooth(0.f, args.sampleTime);
-        lights[MIX1_LIGHT + 1].setBrightnessSmooth(bright1, args.sampleTime);
-        lights[MIX1_LIGHT + 2].setBrightnessSmooth(bright1 * 0.7f, args.sampleTime);
+        lights[MIX1_LIGHT + 0].setBrightnessSmooth(0.f, lightTime);
+        lights[MIX1_LIGHT + 1].setBrightnessSmooth(bright1, lightTime);
+        lights[MIX1_LIGHT + 2].setBrightnessSmooth(bright1 * 0.7f, lightTime);
 
         // Mix 2: Magenta
-        lights[MIX2_LIGHT + 0].setBrightnessSmooth(bright2, args.sampleTime);
-        lights[MIX2_LIGHT + 1].setBrightnessSmooth(0.f, args.sampleTime);
-        lights[MIX2_LIGHT + 2].setBrightnessSmooth(bright2, args.sampleTime);
+        lights[MIX2_LIGHT + 0].setBrightnessSmooth(bright2, lightTime);
+        lights[MIX2_LIGHT + 1].setBrightnessSmooth(0.f, lightTime);
+        lights[MIX2_LIGHT + 2].setBrightnessSmooth(bright2, lightTime);
 
         // Mix 3: Amber
-        lights[MIX3_LIGHT + 0].setBrightnessSmooth(bright3, args.sampleTime);
-        lights[MIX3_LIGHT + 1].setBrightnessSmooth(bright3 * 0.7f, args.sampleTime);
-        lights[MIX3_LIGHT + 2].setBrightnessSmooth(0.f, args.sampleTime);
+        lights[MIX3_LIGHT + 0].setBrightnessSmooth(bright3, lightTime);
+        lights[MIX3_LIGHT + 1].setBrightnessSmooth(bright3 * 0.7f, lightTime);
+        lights[MIX3_LIGHT + 2].setBrightnessSmooth(0.f, lightTime);
     }
 };
 
@@ -939,6 +1175,31 @@ struct TessellationWidget : ModuleWidget {
         nvgFill(args.vg);
     }
 
+    void appendContextMenu(Menu* menu) override {
+        Tessellation* module = dynamic_cast<Tessellation*>(this->module);
+        if (!module)
+            return;
+
+        menu->addChild(new MenuSeparator);
+        menu->addChild(createMenuLabel("Delay interpolation"));
+        static const char* lineNames[tessellation::NUM_DELAYS] = {"Delay 1", "Delay 2", "Delay 3"};
+        for (int i = 0; i < tessellation::NUM_DELAYS; ++i) {
+            menu->addChild(createSubmenuItem(lineNames[i], "", [=](Menu* sub) {
+                sub->addChild(createCheckMenuItem("Linear", "",
+                    [=]{ return module->interpolationModes[i] == 0; },
+                    [=]{ module->interpolationModes[i] = 0; }));
+                sub->addChild(createCheckMenuItem("Hermite (cleaner modulation)", "",
+                    [=]{ return module->interpolationModes[i] == 1; },
+                    [=]{ module->interpolationModes[i] = 1; }));
+            }));
+        }
+
+        menu->addChild(new MenuSeparator);
+        menu->addChild(createCheckMenuItem("Sleep when silent", "",
+            [=]{ return module->sleepWhenSilent; },
+            [=]{ module->sleepWhenSilent = !module->sleepWhenSilent; }));
+    }
+
     TessellationWidget(Tessellation* module) {
         setModule(module);
         setPanel(createPanel(asset::plugin(pluginInstance, "res/panels/Tessellation.svg")));
@@ -1,8 +1,13 @@
 #include "plugin.hpp"
 #include "dsp/audio.hpp"
+#include "dsp/oscillators.hpp"
+#include "dsp/oversampling.hpp"
+#include "ui/menu_helpers.hpp"
 #include <algorithm>
+#include <atomic>
 #include <cmath>
 #include <sstream>
+#include <utility>
 
 namespace {
     constexpr float OUTPUT_SCALE = 5.f;
@@ -47,65 +52,9 @@ namespace {
         return centered * (0.35f + 0.25f * amount);
     }
 
-    constexpr int kFastPowTSize = 256;
-    constexpr int kFastPowExpSize = 128;
-    constexpr float kFastPowExpMin = 0.05f;
-    constexpr float kFastPowExpMax = 5.f;
-    static bool gFastPowLookupInitialized = false;
-    static float gFastPowLookupTable[kFastPowExpSize][kFastPowTSize] = {};
-
-    inline void initializeFastPowLookupTable() {
-        if (gFastPowLookupInitialized) {
-            return;
-        }
-
-        for (int ei = 0; ei < kFastPowExpSize; ++ei) {
-            float expVal = kFastPowExpMin + (kFastPowExpMax - kFastPowExpMin) * ((float)ei / (kFastPowExpSize - 1));
-            for (int ti = 0; ti < kFastPowTSize; ++ti) {
-                float tVal = (float)ti / (kFastPowTSize - 1);
-                gFastPowLookupTable[ei][ti] = std::pow(tVal, expVal);
-            }
-        }
-        gFastPowLookupInitialized = true;
-    }
-
-    // Precomputed pow() table for curve/wave shaping to avoid repeated std::pow calls
+    // Shared pow() table for curve/wave shaping, built at plugin init
     inline float fastPowLookup(float t, float exponent) {
-        constexpr int kTSize = kFastPowTSize;
-        constexpr int kExpSize = kFastPowExpSize;
-        constexpr float kExpMin = kFastPowExpMin;
-        constexpr float kExpMax = kFastPowExpMax;
-
-        t = rack::math::clamp(t, 0.f, 1.f);
-        exponent = rack::math::clamp(exponent, kExpMin, kExpMax);
-
-        if (t <= 0.f) {
-            return 0.f;
-        }
-        if (t >= 1.f) {
-            return 1.f;
-        }
-
-        if (!gFastPowLookupInitialized) {
-            initializeFastPowLookupTable();
-        }
-
-        float ePos = (exponent - kExpMin) * (kExpSize - 1) / (kExpMax - kExpMin);
-        int eIdx = rack::math::clamp((int)ePos, 0, kExpSize - 2);
-        float eFrac = ePos - (float)eIdx;
-
-        float tPos = t * (kTSize - 1);
-        int tIdx = rack::math::clamp((int)tPos, 0, kTSize - 2);
-        float tFrac = tPos - (float)tIdx;
-
-        float v00 = gFastPowLookupTable[eIdx][tIdx];
-        float v01 = gFastPowLookupTable[eIdx][tIdx + 1];
-        float v10 = gFastPowLookupTable[eIdx + 1][tIdx];
-        float v11 = gFastPowLookupTable[eIdx + 1][tIdx + 1];
-
-        float v0 = rack::math::crossfade(v00, v01, tFrac);
-        float v1 = rack::math::crossfade(v10, v11, tFrac);
-        return rack::math::crossfade(v0, v1, eFrac);
+        return shapetaker::dsp::PowTable::shared().lookup(t, exponent);
     }
 
     inline void fastSinCos2Pi(float phase, float& s, float& c) {
@@ -144,6 +93,48 @@ namespace {
         return rack::math::clamp(baseBreak + bias, 0.02f, 0.98f);
     }
 
+    // Breakpoint and segment curves of a warp shape; Double runs them twice per cycle
+    struct CZWarpSegments {
+        float breakPoint;
+        float attackCurve;
+        float releaseCurve;
+        bool doubled;
+    };
+
+    bool czWarpSegments(float amount, float bias, CZWarpShape shape, CZWarpSegments& seg) {
+        float breakPoint = computeBreakPoint(amount, bias);
+        seg.breakPoint = breakPoint;
+        seg.attackCurve = 1.f;
+        seg.releaseCurve = 1.f;
+        seg.doubled = false;
+
+        switch (shape) {
+            case CZWarpShape::Single:
+                return true;
+            case CZWarpShape::Resonant:
+                seg.attackCurve = lerp(1.f, 0.22f, amount);
+                seg.releaseCurve = lerp(1.f, 2.8f, amount);
+                return true;
+            case CZWarpShape::Double:
+                seg.breakPoint = rack::math::clamp(breakPoint * lerp(0.9f, 0.55f, amount), 0.02f, 0.98f);
+                seg.doubled = true;
+                return true;
+            case CZWarpShape::SawPulse:
+                seg.breakPoint = rack::math::clamp(breakPoint * lerp(0.85f, 0.5f, amount), 0.02f, 0.95f);
+                seg.attackCurve = lerp(1.f, 0.4f, amount);
+                seg.releaseCurve = lerp(1.f, 0.2f, amount);
+                return true;
+            case CZWarpShape::Pulse:
+                seg.breakPoint = rack::math::clamp(breakPoint * lerp(0.7f, 0.18f, amount), 0.02f, 0.9f);
+                seg.attackCurve = lerp(1.f, 0.6f, amount);
+                seg.releaseCurve = lerp(1.f, 2.2f, amount);
+                return true;
+            default:
+                break;
+        }
+        return false;
+    }
+
     float applyCZWarp(float phase, float amount, float bias, CZWarpShape shape) {
         amount = rack::math::clamp(amount, 0.f, 1.f);
         phase = rack::math::eucMod(phase, 1.f);
@@ -151,38 +142,102 @@ namespace {
             return phase;
         }
 
-        float breakPoint = computeBreakPoint(amount, bias);
+        CZWarpSegments seg;
+        if (!czWarpSegments(amount, bias, shape, seg)) {
+            return phase;
+        }
+        if (seg.doubled) {
+            float localPhase = (phase < 0.5f) ? phase * 2.f : (phase - 0.5f) * 2.f;
+            float warped = warpSegment(localPhase, seg.breakPoint, seg.attackCurve, seg.releaseCurve);
+            return (phase < 0.5f) ? warped * 0.5f : 0.5f + warped * 0.5f;
+        }
+        return warpSegment(phase, seg.breakPoint, seg.attackCurve, seg.releaseCurve);
+    }
 
-        switch (shape) {
-            case CZWarpShape::Single:
-                return warpSegment(phase, breakPoint, 1.f, 1.f);
-            case CZWarpShape::Resonant: {
-                float attackCurve = lerp(1.f, 0.22f, amount);
-                float releaseCurve = lerp(1.f, 2.8f, amount);
-                return warpSegment(phase, breakPoint, attackCurve, releaseCurve);
-            }
-            case CZWarpShape::Double: {
-                float localPhase = (phase < 0.5f) ? phase * 2.f : (phase - 0.5f) * 2.f;
-                float localBreak = rack::math::clamp(breakPoint * lerp(0.9f, 0.55f, amount), 0.02f, 0.98f);
-                float warped = warpSegment(localPhase, localBreak, 1.f, 1.f);
-                return (phase < 0.5f) ? warped * 0.5f : 0.5f + warped * 0.5f;
-            }
-            case CZWarpShape::SawPulse: {
-                float sawBreak = rack::math::clamp(breakPoint * lerp(0.85f, 0.5f, amount), 0.02f, 0.95f);
-                float attackCurve = lerp(1.f, 0.4f, amount);
-                float releaseCurve = lerp(1.f, 0.2f, amount);
-                return warpSegment(phase, sawBreak, attackCurve, releaseCurve);
-            }
-            case CZWarpShape::Pulse: {
-                float pulseBreak = rack::math::clamp(breakPoint * lerp(0.7f, 0.18f, amount), 0.02f, 0.9f);
-                float attackCurve = lerp(1.f, 0.6f, amount);
-                float releaseCurve = lerp(1.f, 2.2f, amount);
-                return warpSegment(phase, pulseBreak, attackCurve, releaseCurve);
+    // Slope corners of the warp curve: where they sit in the cycle and how much
+    // d(warped)/d(phase) changes across them
+    struct CZWarpCorners {
+        static constexpr int kMaxCorners = 4;
+        int count;
+        float position[kMaxCorners];  // (0, 1]
+        float slopeChange[kMaxCorners];
+    };
+
+    // Slope of a warpSegment() curve at the cycle boundary. Curves below 1
+    // meet it with an infinite slope (a cusp), which BLAMP cannot describe.
+    bool segmentEdgeSlope(float curve, float span, float& slope) {
+        if (curve > 1.f) {
+            slope = 0.f;
+            return true;
+        }
+        if (curve == 1.f) {
+            slope = 0.5f / span;
+            return true;
+        }
+        return false;
+    }
+
+    void czWarpCorners(float amount, float bias, CZWarpShape shape, CZWarpCorners& corners) {
+        corners.count = 0;
+        amount = rack::math::clamp(amount, 0.f, 1.f);
+        CZWarpSegments seg;
+        if (amount <= 1e-5f || !czWarpSegments(amount, bias, shape, seg)) {
+            return;
+        }
+        // Same clamps as warpSegment()
+        float breakPoint = rack::math::clamp(seg.breakPoint, 0.02f, 0.98f);
+        float attackCurve = rack::math::clamp(seg.attackCurve, 0.05f, 4.f);
+        float releaseCurve = rack::math::clamp(seg.releaseCurve, 0.05f, 4.f);
+
+        float breakChange = 0.5f * releaseCurve / (1.f - breakPoint) - 0.5f * attackCurve / breakPoint;
+        float endSlope = 0.f;
+        float startSlope = 0.f;
+        bool wrapCorner = segmentEdgeSlope(releaseCurve, 1.f - breakPoint, endSlope) &&
+                          segmentEdgeSlope(attackCurve, breakPoint, startSlope) &&
+                          startSlope != endSlope;
+
+        // Double squeezes the whole curve into each half; slopes are unchanged
+        int repeats = seg.doubled ? 2 : 1;
+        float span = 1.f / (float)repeats;
+        for (int r = 0; r < repeats; ++r) {
+            float offset = span * (float)r;
+            corners.position[corners.count] = offset + breakPoint * span;
+            corners.slopeChange[corners.count++] = breakChange;
+            if (wrapCorner) {
+                corners.position[corners.count] = offset + span;
+                corners.slopeChange[corners.count++] = startSlope - endSlope;
             }
-            default:
-                break;
         }
-        return phase;
+    }
+
+    // Adds BLAMP residuals for each warp corner crossed on the way from
+    // prevPhase to phase. prevWarped is the sample held back for output.
+    void correctWarpCorners(float prevPhase, float phase, float amount, float bias, CZWarpShape shape,
+                            float& prevWarped, float& warped) {
+        float step = phase - prevPhase;
+        if (step < 0.f) {
+            step += 1.f;
+        }
+        // Resets and large feedback jumps are not corners
+        if (step <= 0.f || step >= 0.5f) {
+            return;
+        }
+        CZWarpCorners corners;
+        czWarpCorners(amount, bias, shape, corners);
+        float end = prevPhase + step;
+        for (int i = 0; i < corners.count; ++i) {
+            float position = corners.position[i];
+            if (position <= prevPhase) {
+                position += 1.f;
+            }
+            if (position > end) {
+                continue;
+            }
+            float d = (end - position) / step;
+            float change = corners.slopeChange[i] * step;
+            prevWarped += change * shapetaker::dsp::OscillatorHelper::polyBLAMP(d - 1.f);
+            warped += change * shapetaker::dsp::OscillatorHelper::polyBLAMP(d);
+        }
     }
 
 }
@@ -287,6 +342,33 @@ struct Torsion : Module {
     // DC blocking filters for clean output (prevents clicks/pops)
     shapetaker::dsp::VoiceArray<DcBlocker> dcBlockers;
 
+    // Anti-aliasing of the phase-distortion core (main and edge paths)
+    enum OscQuality {
+        OSC_QUALITY_RAW = 0,   // 1x, hard warp corners
+        OSC_QUALITY_CLEAN,     // 1x with BLAMP-rounded corners
+        OSC_QUALITY_HIGH,      // 2x + BLAMP
+        OSC_QUALITY_ULTRA,     // 4x + BLAMP
+        OSC_QUALITY_COUNT
+    };
+    static constexpr int kMaxOversample = 4;
+    std::atomic<int> oscQuality = {OSC_QUALITY_CLEAN};  // new instances; old patches load Raw
+    int activeOversample = 0;
+    bool activeBandlimit = false;
+
+    // BLAMP also corrects the sample before each corner, so the core output
+    // runs one core sample behind
+    struct CoreHistory {
+        float phaseA = 0.f;
+        float warpedA = 0.f;
+        float phaseB = 0.f;
+        float warpedB = 0.f;
+        float dcwB = 0.f;
+        bool primed = false;
+    };
+    shapetaker::dsp::VoiceArray<CoreHistory> coreHistory;
+    shapetaker::dsp::VoiceArray<shapetaker::dsp::Oversampler> mainDecimators;
+    shapetaker::dsp::VoiceArray<shapetaker::dsp::Oversampler> edgeDecimators;
+
     // Click suppression fade-out ramp for smooth envelope endings
     shapetaker::dsp::VoiceArray<float> clickSuppressor;  // 1.0 = normal, 0.0 = fully faded
 
@@ -296,6 +378,9 @@ struct Torsion : Module {
     bool dcwVelocityEnabled = false;
     bool chorusEnabled = false;
     bool phaseResetEnabled = false;
+    // Drive-stage tanh: fastmath (eco) or libm (precise)
+    shapetaker::dsp::MathModeSetting mathSetting;
+    shapetaker::dsp::MathMode math;  // what process() runs with
     static constexpr int kNumStages = 6;
     static constexpr float kStageRateBase = 10.f;
     float vintageClockPhase = 0.f;
@@ -327,6 +412,9 @@ struct Torsion : Module {
     static constexpr int kReleaseTableSize = 64;
     float releaseCoeffTable[kReleaseTableSize] = {};
 
+    // Stage LED heat map runs at control rate
+    shapetaker::dsp::ControlRateTicker lightTicker;
+
     // Chorus LFO decimation
     int chorusLfoCounter = 0;
     static constexpr int kChorusLfoDecimation = 16;  // Update every 16 samples
@@ -339,7 +427,6 @@ struct Torsion : Module {
     int vintageNoiseIndex = 0;
 
     Torsion() {
-        initializeFastPowLookupTable();
         config(PARAMS_LEN, INPUTS_LEN, OUTPUTS_LEN, LIGHTS_LEN);
 
         configParam(COARSE_PARAM, -2.f, 2.f, 0.f, "octave", " oct");
@@ -422,6 +509,74 @@ struct Torsion : Module {
         shapetaker::ui::LabelFormatter::normalizeModuleControls(this);
     }
 
+    static int oversampleForQuality(int quality) {
+        switch (quality) {
+            case OSC_QUALITY_HIGH: return 2;
+            case OSC_QUALITY_ULTRA: return kMaxOversample;
+            default: return 1;
+        }
+    }
+
+    void updateOversampling() {
+        int quality = rack::math::clamp(oscQuality.load(std::memory_order_relaxed), 0, OSC_QUALITY_COUNT - 1);
+        bool bandlimit = quality != OSC_QUALITY_RAW;
+        if (bandlimit != activeBandlimit) {
+            activeBandlimit = bandlimit;
+            coreHistory.forEach([](CoreHistory& history) { history.primed = false; });
+        }
+        int factor = oversampleForQuality(quality);
+        if (factor == activeOversample) {
+            return;
+        }
+        activeOversample = factor;
+        coreHistory.forEach([](CoreHistory& history) { history.primed = false; });
+        auto configure = [factor](shapetaker::dsp::Oversampler& os) {
+            os.configure(factor, shapetaker::dsp::Oversampler::QUALITY_STANDARD);
+            os.reset();
+        };
+        mainDecimators.forEach(configure);
+        edgeDecimators.forEach(configure);
+    }
+
+    // Advances A, B and sub phases for one (sub)sample. Returns true when A wrapped.
+    bool advanceOscillatorPhases(int ch, float freqA, float freqB, float sampleTime, bool resetSync) {
+        float phaseA = primaryPhase[ch] + freqA * sampleTime;
+        bool wrappedA = phaseA >= 1.f;
+        if (wrappedA) {
+            // Simple subtraction is faster than floor when phase is expected to be < 2.0
+            phaseA -= 1.f;
+            // Handle edge case where phase might be >= 2.0 (very high frequencies)
+            if (phaseA >= 1.f) {
+                phaseA -= std::floor(phaseA);
+            }
+        }
+
+        float phaseB = secondaryPhase[ch] + freqB * sampleTime;
+        if (resetSync && wrappedA) {
+            phaseB = phaseA;
+        }
+        if (phaseB >= 1.f) {
+            phaseB -= 1.f;
+            if (phaseB >= 1.f) {
+                phaseB -= std::floor(phaseB);
+            }
+        }
+
+        primaryPhase[ch] = phaseA;
+        secondaryPhase[ch] = phaseB;
+
+        // Sub-oscillator at -1 octave (free-running)
+        float phaseSub = subPhase[ch] + freqA * 0.5f * sampleTime;
+        if (phaseSub >= 1.f) {
+            phaseSub -= 1.f;
+            if (phaseSub >= 1.f) {
+                phaseSub -= std::floor(phaseSub);
+            }
+        }
+        subPhase[ch] = phaseSub;
+        return wrappedA;
+    }
+
     void resetChorusState() {
         chorusVoices.forEach([](ChorusVoiceState& voice) {
             voice.reset();
@@ -458,6 +613,7 @@ struct Torsion : Module {
         stageActive.reset();
         stageEnvelope.reset();
         dcBlockers.forEach([](DcBlocker& db) { db.reset(); });
+        coreHistory.forEach([](CoreHistory& history) { history.primed = false; });
         clickSuppressor.reset();
         for (int i = 0; i < 16; i++) {
             clickSuppressor[i] = 1.0f;  // Start fully active
@@ -474,6 +630,7 @@ struct Torsion : Module {
         dcwKeyTrackEnabled = false;
         dcwVelocityEnabled = false;
         chorusEnabled = false;
+        oscQuality.store(OSC_QUALITY_CLEAN, std::memory_order_relaxed);
         params[CHORUS_PARAM].setValue(0.f);
         vintageClockPhase = 0.f;
         resetChorusState();
@@ -499,6 +656,8 @@ struct Torsion : Module {
         chorusEnabled = params[CHORUS_PARAM].getValue() > 0.5f;
         json_object_set_new(rootJ, "chorusEnabled", json_boolean(chorusEnabled));
         json_object_set_new(rootJ, "phaseResetEnabled", json_boolean(phaseResetEnabled));
+        json_object_set_new(rootJ, "oscQuality", json_integer(oscQuality.load(std::memory_order_relaxed)));
+        mathSetting.dataToJson(rootJ);
         return rootJ;
     }
 
@@ -552,15 +711,29 @@ struct Torsion : Module {
         if (phaseResetJ) {
             phaseResetEnabled = json_is_true(phaseResetJ);
         }
+        mathSetting.dataFromJson(rootJ);
+        // Patches saved before the quality modes had hard warp corners
+        int quality = OSC_QUALITY_RAW;
+        json_t* qualityJ = json_object_get(rootJ, "oscQuality");
+        if (qualityJ) {
+            quality = rack::math::clamp((int)json_integer_value(qualityJ), 0, OSC_QUALITY_COUNT - 1);
+        }
+        oscQuality.store(quality, std::memory_order_relaxed);
         chorusEnabled = params[CHORUS_PARAM].getValue() > 0.5f;
         resetChorusState();
     }
 
     void process(const ProcessArgs& args) override {
+        mathSetting.apply(math);
         int channels = polyProcessor.updateChannels(
             {inputs[VOCT_INPUT], inputs[GATE_INPUT], inputs[TORSION_CV_INPUT], inputs[FEEDBACK_CV_INPUT], inputs[STAGE_TRIG_INPUT]},
             {outputs[MAIN_L_OUTPUT], outputs[MAIN_R_OUTPUT], outputs[EDGE_OUTPUT]});
 
+        updateOversampling();
+        const int oversample = activeOversample;
+        const bool bandlimit = activeBandlimit;
+        const float coreSampleTime = args.sampleTime / (float)oversample;
+
         bool chorusParamOn = params[CHORUS_PARAM].getValue() > 0.5f;
         if (chorusEnabled != chorusParamOn) {
             chorusEnabled = chorusParamOn;
@@ -787,47 +960,11 @@ struct Torsion : Module {
                 primaryPhase[ch] = 0.f;
                 secondaryPhase[ch] = 0.f;
                 subPhase[ch] = 0.f;
+                coreHistory[ch].primed = false;
             }
 
-            float phaseA = primaryPhase[ch] + freqA * args.sampleTime;
-            bool wrappedA = phaseA >= 1.f;
-            if (wrappedA) {
-                // Simple subtraction is faster than floor when phase is expected to be < 2.0
-                phaseA -= 1.f;
-                // Handle edge case where phase might be >= 2.0 (very high frequencies)
-                if (phaseA >= 1.f) {
-                    phaseA -= std::floor(phaseA);
-                }
-            }
-
-            float phaseB = secondaryPhase[ch] + freqB * args.sampleTime;
-            if (activeInteraction == INTERACTION_RESET_SYNC && wrappedA) {
-                phaseB = phaseA;
-            }
-            if (phaseB >= 1.f) {
-                // Simple subtraction is faster than floor when phase is expected to be < 2.0
-                phaseB -= 1.f;
-                // Handle edge case where phase might be >= 2.0 (very high frequencies)
-                if (phaseB >= 1.f) {
-                    phaseB -= std::floor(phaseB);
-                }
-            }
-
-            primaryPhase[ch] = phaseA;
-            secondaryPhase[ch] = phaseB;
-
-            // Sub-oscillator at -1 octave (free-running)
-            float freqSub = freqA * 0.5f;
-            float phaseSub = subPhase[ch] + freqSub * args.sampleTime;
-            if (phaseSub >= 1.f) {
-                // Simple subtraction is faster than floor when phase is expected to be < 2.0
-                phaseSub -= 1.f;
-                // Handle edge case where phase might be >= 2.0 (very high frequencies)
-                if (phaseSub >= 1.f) {
-                    phaseSub -= std::floor(phaseSub);
-                }
-            }
-            subPhase[ch] = phaseSub;
+            // Phases advance inside the (oversampled) core below
+            const bool resetSync = activeInteraction == INTERACTION_RESET_SYNC;
 
             float stagePos = stagePositions[ch];
 
@@ -999,6 +1136,8 @@ struct Torsion : Module {
 
             // Only silence output when envelope AND click suppressor are truly negligible
             if (env <= 1e-6f && clickSuppressor[ch] <= 1e-6f) {
+                advanceOscillatorPhases(ch, freqA, freqB, args.sampleTime, resetSync);
+                coreHistory[ch].primed = false;
                 outputs[MAIN_L_OUTPUT].setVoltage(0.f, ch);
                 outputs[MAIN_R_OUTPUT].setVoltage(0.f, ch);
                 outputs[EDGE_OUTPUT].setVoltage(0.f, ch);
@@ -1009,12 +1148,6 @@ struct Torsion : Module {
 
             float dcwEnv = rack::math::clamp(env * torsionA, 0.f, 1.f);
             float dcwA = softWarpAmount(dcwEnv);
-            float dcwB = softWarpAmount(dcwEnv);
-
-            if (activeInteraction == INTERACTION_DCW_FOLLOW) {
-                float influence = std::fabs(std::sin(2.f * M_PI * phaseA));
-                dcwB = rack::math::clamp(dcwEnv * influence, 0.f, 1.f);
-            }
 
             float feedbackAmount = feedbackBase;
             if (feedbackCvConnected) {
@@ -1024,52 +1157,99 @@ struct Torsion : Module {
 
             // Apply feedback to phase (use cached param read - optimization #2)
             float feedbackMod = feedbackSignal[ch] * feedbackAmount * 0.3f;
-            float phaseAFinal = phaseA + feedbackMod;
-            phaseAFinal = phaseAFinal - std::floor(phaseAFinal);
-
             float biasA = shapeBias(symmetry, dcwA);
-            float biasB = shapeBias(symmetry, dcwB);
-            float warpedA = applyCZWarp(phaseAFinal, dcwA, biasA, warpShape);
-            float warpedB = applyCZWarp(phaseB, dcwB, biasB, warpShape);
-
-            // Unwarped bases (selected waveforms, no torsion) for smooth crossfade and edge calc
-            float baseA = buildWarpedVoice(phaseAFinal, 0.f);
-            float baseB = buildWarpedVoice(phaseB, 0.f);
-
-            // Build warped voices using hoisted lambda
-            float shapedA = buildWarpedVoice(warpedA, dcwA);
-            float shapedB = buildWarpedVoice(warpedB, dcwB);
-            // Crossfade toward unwarped base when torsion is low to avoid zippering/zeroing
-            shapedA = rack::math::crossfade(baseA, shapedA, dcwA);
-            shapedB = rack::math::crossfade(baseB, shapedB, dcwB);
-
-            float interactionGain = 1.f;
-            if (activeInteraction == INTERACTION_DCW_FOLLOW) {
-                shapedB = rack::math::crossfade(shapedB, baseB, 0.25f);
-                interactionGain = 1.15f;
-            } else if (activeInteraction == INTERACTION_RING_MOD) {
-                shapedB = shapedA * shapedB;
-                interactionGain = 1.7f;
-            }
-
-            // Generate sub-oscillator (pure sine wave, -1 octave)
-            float subSin, subCos;
-            fastSinCos2Pi(phaseSub, subSin, subCos);
-            float subSignal = subSin * subLevel;
-            float primaryActivity = 0.5f * (std::fabs(shapedA) + std::fabs(shapedB));
-            float subTrim = 1.f / (1.f + primaryActivity * 0.9f);
-            subSignal *= subTrim;
-
-            // Main output: mix both oscillators with balanced gain staging
-            // Envelope modulates torsion, not amplitude directly
-            float mainSignal = env * interactionGain * 0.5f * (shapedA + shapedB) + subSignal * env;
-
-            // Edge output: blend between base tone (low torsion) and torsion difference (high torsion)
-            float baseSum = baseA + baseB;
-            float torsionDifference = (shapedA - baseA) + (shapedB - baseB);
-            float edgeContribution = torsionDifference + baseSum * (1.f - dcwEnv);
-            float edgeGain = 0.4f;
-            float edgeSignal = env * interactionGain * edgeGain * edgeContribution;
+
+            // Phase-distortion core: runs `oversample` times per engine sample.
+            // Envelope gain is applied after decimation since it moves slowly.
+            float coreMain[kMaxOversample];
+            float coreEdge[kMaxOversample];
+            for (int os = 0; os < oversample; ++os) {
+                bool wrappedA = advanceOscillatorPhases(ch, freqA, freqB, coreSampleTime, resetSync);
+                float phaseA = primaryPhase[ch];
+                float phaseB = secondaryPhase[ch];
+                float phaseSub = subPhase[ch];
+
+                float dcwB = dcwA;
+                if (activeInteraction == INTERACTION_DCW_FOLLOW) {
+                    float influence = std::fabs(std::sin(2.f * M_PI * phaseA));
+                    dcwB = rack::math::clamp(dcwEnv * influence, 0.f, 1.f);
+                }
+
+                float phaseAFinal = phaseA + feedbackMod;
+                phaseAFinal = phaseAFinal - std::floor(phaseAFinal);
+
+                float biasB = shapeBias(symmetry, dcwB);
+                float warpedA = applyCZWarp(phaseAFinal, dcwA, biasA, warpShape);
+                float warpedB = applyCZWarp(phaseB, dcwB, biasB, warpShape);
+
+                if (bandlimit) {
+                    CoreHistory& history = coreHistory[ch];
+                    if (history.primed) {
+                        correctWarpCorners(history.phaseA, phaseAFinal, dcwA, biasA, warpShape,
+                                           history.warpedA, warpedA);
+                        // A hard-sync reset is a jump, not a corner
+                        if (!(resetSync && wrappedA)) {
+                            correctWarpCorners(history.phaseB, phaseB, dcwB, biasB, warpShape,
+                                               history.warpedB, warpedB);
+                        }
+                    } else {
+                        history.phaseA = phaseAFinal;
+                        history.warpedA = warpedA;
+                        history.phaseB = phaseB;
+                        history.warpedB = warpedB;
+                        history.dcwB = dcwB;
+                        history.primed = true;
+                    }
+                    // Output the held sample, keep this one for the next corner
+                    std::swap(history.phaseA, phaseAFinal);
+                    std::swap(history.warpedA, warpedA);
+                    std::swap(history.phaseB, phaseB);
+                    std::swap(history.warpedB, warpedB);
+                    std::swap(history.dcwB, dcwB);
+                }
+
+                // Unwarped bases (selected waveforms, no torsion) for smooth crossfade and edge calc
+                float baseA = buildWarpedVoice(phaseAFinal, 0.f);
+                float baseB = buildWarpedVoice(phaseB, 0.f);
+
+                // Build warped voices using hoisted lambda
+                float shapedA = buildWarpedVoice(warpedA, dcwA);
+                float shapedB = buildWarpedVoice(warpedB, dcwB);
+                // Crossfade toward unwarped base when torsion is low to avoid zippering/zeroing
+                shapedA = rack::math::crossfade(baseA, shapedA, dcwA);
+                shapedB = rack::math::crossfade(baseB, shapedB, dcwB);
+
+                float interactionGain = 1.f;
+                if (activeInteraction == INTERACTION_DCW_FOLLOW) {
+                    shapedB = rack::math::crossfade(shapedB, baseB, 0.25f);
+                    interactionGain = 1.15f;
+                } else if (activeInteraction == INTERACTION_RING_MOD) {
+                    shapedB = shapedA * shapedB;
+                    interactionGain = 1.7f;
+                }
+
+                // Generate sub-oscillator (pure sine wave, -1 octave)
+                float subSin, subCos;
+                fastSinCos2Pi(phaseSub, subSin, subCos);
+                float subSignal = subSin * subLevel;
+                float primaryActivity = 0.5f * (std::fabs(shapedA) + std::fabs(shapedB));
+                float subTrim = 1.f / (1.f + primaryActivity * 0.9f);
+                subSignal *= subTrim;
+
+                // Main output: mix both oscillators with balanced gain staging
+                // Envelope modulates torsion, not amplitude directly
+                coreMain[os] = interactionGain * 0.5f * (shapedA + shapedB) + subSignal;
+
+                // Edge output: blend between base tone (low torsion) and torsion difference (high torsion)
+                float baseSum = baseA + baseB;
+                float torsionDifference = (shapedA - baseA) + (shapedB - baseB);
+                float edgeContribution = torsionDifference + baseSum * (1.f - dcwEnv);
+                float edgeGain = 0.4f;
+                coreEdge[os] = interactionGain * edgeGain * edgeContribution;
+            }
+
+            float mainSignal = env * mainDecimators[ch].downsample(coreMain);
+            float edgeSignal = env * edgeDecimators[ch].downsample(coreEdge);
 
             // In trigger mode, apply a dedicated fast tail once the stage sequence has ended
             if (trigConnected) {
@@ -1108,16 +1288,16 @@ struct Torsion : Module {
                 // Stronger, slightly asymmetric drive for audible grit
                 float drive = 2.0f;
                 float asym = 0.08f;
-                float drivenMain = std::tanh(mainSignal * drive + asym * mainSignal * mainSignal);
-                float drivenEdge = std::tanh(edgeSignal * drive + asym * edgeSignal * edgeSignal);
+                float drivenMain = math.tanh(mainSignal * drive + asym * mainSignal * mainSignal);
+                float drivenEdge = math.tanh(edgeSignal * drive + asym * edgeSignal * edgeSignal);
                 constexpr float dirtyScale = 0.75f;
                 mainOut = drivenMain * dirtyScale;
                 edgeOut = drivenEdge * dirtyScale;
             } else {
                 constexpr float cleanDrive = 0.75f;
                 constexpr float cleanScale = 1.f / cleanDrive;  // Unity gain around 0 V
-                mainOut = std::tanh(mainSignal * cleanDrive) * cleanScale;
-                edgeOut = std::tanh(edgeSignal * cleanDrive) * cleanScale;
+                mainOut = math.tanh(mainSignal * cleanDrive) * cleanScale;
+                edgeOut = math.tanh(edgeSignal * cleanDrive) * cleanScale;
             }
 
             // Apply click suppressor to prevent pops at envelope end
@@ -1171,6 +1351,10 @@ struct Torsion : Module {
                 shapetaker::AudioProcessor::softLimit(edgeOut * OUTPUT_SCALE, 10.0f), ch);
         }
 
+        if (!lightTicker.tick(args.sampleTime)) {
+            return;
+        }
+
         // Update polyphonic stage LEDs with brightness stacking
         // Accumulate brightness from all active voices for a "heat map" effect
         float stageBrightness[kNumStages] = {};
@@ -1189,7 +1373,7 @@ struct Torsion : Module {
         }
 
         // Normalize brightness by channel count to prevent over-saturation
-        float lightSlew = args.sampleTime * 8.f;
+        float lightSlew = lightTicker.getElapsed() * 8.f;
         float normalizeFactor = (channels > 1) ? (1.f / std::sqrt((float)channels)) : 1.f;
         for (int i = 0; i < kNumStages; ++i) {
             // Boost brightness for clearer indication inside the bezel
@@ -1918,6 +2102,39 @@ struct TorsionWidget : ModuleWidget {
         vintageItem->module = module;
         vintageItem->text = "Vintage mode (hiss/bleed/drift)";
         menu->addChild(vintageItem);
+
+        menu->addChild(shapetaker::ui::createPreciseMathItem(&module->mathSetting));
+
+        menu->addChild(new ui::MenuSeparator());
+        auto* qualityHeading = new ui::MenuLabel;
+        qualityHeading->text = "Oscillator quality";
+        menu->addChild(qualityHeading);
+
+        struct QualityItem : ui::MenuItem {
+            Torsion* module;
+            int quality = Torsion::OSC_QUALITY_RAW;
+            void onAction(const event::Action& e) override {
+                module->oscQuality.store(quality, std::memory_order_relaxed);
+            }
+            void step() override {
+                rightText = module->oscQuality.load(std::memory_order_relaxed) == quality ? "✔" : "";
+                ui::MenuItem::step();
+            }
+        };
+
+        const char* qualityNames[Torsion::OSC_QUALITY_COUNT] = {
+            "Raw (1x)",
+            "Band-limited corners (1x)",
+            "Band-limited, 2x oversampled",
+            "Band-limited, 4x oversampled",
+        };
+        for (int quality = 0; quality < Torsion::OSC_QUALITY_COUNT; ++quality) {
+            auto* item = new QualityItem;
+            item->module = module;
+            item->quality = quality;
+            item->text = qualityNames[quality];
+            menu->addChild(item);
+        }
         }
     };
 
@@ -2,6 +2,7 @@
 #include <rack.hpp>
 #include <functional>
 #include <string>
+#include "../dsp/fastmath.hpp"
 
 using namespace rack;
 
@@ -193,4 +194,15 @@ rack::ui::Slider* createDecibelSlider(
     return slider;
 }
 
+// ============================================================================
+// ECO / PRECISE MATH
+// ============================================================================
+
+// The "Precise math" toggle every module with a dsp::MathModeSetting shows
+inline rack::ui::MenuItem* createPreciseMathItem(shapetaker::dsp::MathModeSetting* setting) {
+    return rack::createCheckMenuItem("Precise math", "",
+        [=] { return setting->isPrecise(); },
+        [=] { setting->setPrecise(!setting->isPrecise()); });
+}
+
 }} // namespace shapetaker::ui
@@ -12,6 +12,11 @@
 #include "dsp/polyphony.hpp"
 #include "dsp/delays.hpp"
 #include "dsp/pitch.hpp"
+#include "dsp/oversampling.hpp"
+#include "dsp/control.hpp"
+#include "dsp/pow_table.hpp"
+#include "dsp/fastmath.hpp"
+#include "dsp/sleep.hpp"
 
 // Graphics Utilities
 #include "graphics/drawing.hpp"
@@ -46,6 +51,7 @@ namespace shapetaker {
     using EnvelopeFollower = dsp::EnvelopeFollower;
     using FastSmoother = dsp::FastSmoother;
     using PitchHelper = dsp::PitchHelper;
+    using ControlRateTicker = dsp::ControlRateTicker;
 
     // Convenience aliases for voice arrays
     template<typename T, int SIZE = dsp::PolyphonicProcessor::MAX_VOICES>